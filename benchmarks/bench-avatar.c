@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "benchmark.h"
+
+static const int sizes[] = { 10, 100, 1000 };
+
+static void
+run_case (Benchmark *bench,
+          int        n_avatars)
+{
+  g_autofree char *case_name = g_strdup_printf ("%d avatars", n_avatars);
+  GtkWidget *box;
+  gint64 start;
+  int i;
+
+  box = gtk_box_new (GTK_ORIENTATION_VERTICAL, 6);
+
+  start = g_get_monotonic_time ();
+
+  for (i = 0; i < n_avatars; i++) {
+    g_autofree char *name = g_strdup_printf ("Contact %d", i);
+
+    gtk_box_append (GTK_BOX (box), adw_avatar_new (32, name, TRUE));
+  }
+
+  benchmark_add_result (bench, case_name, "create",
+                        (double) (g_get_monotonic_time () - start) / n_avatars,
+                        "usec");
+
+  benchmark_run_layout (bench, case_name, box, 360, 0);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  Benchmark *bench = benchmark_new ("avatar", &argc, &argv);
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++)
+    run_case (bench, sizes[i]);
+
+  return benchmark_finish (bench);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "benchmark.h"
+
+static const int sizes[] = { 10, 100, 1000, 10000 };
+
+static void
+run_case (Benchmark *bench,
+          int        n_pages)
+{
+  g_autofree char *case_name = g_strdup_printf ("%d pages", n_pages);
+  AdwCarousel *carousel;
+  gint64 start;
+  int i;
+
+  carousel = ADW_CAROUSEL (adw_carousel_new ());
+
+  start = g_get_monotonic_time ();
+
+  for (i = 0; i < n_pages; i++) {
+    g_autofree char *label = g_strdup_printf ("Page %d", i);
+
+    adw_carousel_append (carousel, gtk_label_new (label));
+  }
+
+  benchmark_add_result (bench, case_name, "append",
+                        (double) (g_get_monotonic_time () - start) / n_pages,
+                        "usec");
+
+  benchmark_run_layout (bench, case_name, GTK_WIDGET (carousel), 360, 640);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  Benchmark *bench = benchmark_new ("carousel", &argc, &argv);
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++) {
+    if (benchmark_is_quick (bench) && sizes[i] > 1000)
+      continue;
+
+    run_case (bench, sizes[i]);
+  }
+
+  return benchmark_finish (bench);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "benchmark.h"
+
+#include "adw-fade-private.h"
+
+/* Compares the GL shader and the fallback implementations of edge fades and
+ * masks. Which one is used depends on the renderer: run with GSK_RENDERER=gl
+ * for shaders, and additionally set ADW_DEBUG_NO_GL_SHADERS=1 to use the
+ * fallback with the same renderer. The fallback uses mask nodes with GTK 4.10
+ * and newer, and cached cairo textures before that. */
+
+static const int sizes[] = { 5, 20 };
+
+static const char *
+get_path_name (void)
+{
+  const char *renderer = g_getenv ("GSK_RENDERER");
+
+  if (g_getenv ("ADW_DEBUG_NO_GL_SHADERS") || !g_strcmp0 (renderer, "cairo"))
+    return ADW_HAS_MASK_NODES ? "mask nodes" : "textures";
+
+  return "shaders";
+}
+
+static void
+run_tabs_case (Benchmark *bench,
+               int        n_tabs)
+{
+  g_autofree char *case_name =
+    g_strdup_printf ("%d fading tabs, %s", n_tabs, get_path_name ());
+  g_autoptr (AdwTabView) view = NULL;
+  AdwTabBar *bar;
+  int i;
+
+  view = g_object_ref_sink (ADW_TAB_VIEW (adw_tab_view_new ()));
+  bar = adw_tab_bar_new ();
+  adw_tab_bar_set_autohide (bar, FALSE);
+  adw_tab_bar_set_view (bar, view);
+
+  /* Long enough that every title is faded out */
+  for (i = 0; i < n_tabs; i++) {
+    g_autofree char *title =
+      g_strdup_printf ("Tab %d with a title that is too long to fit", i);
+    AdwTabPage *page = adw_tab_view_append (view, gtk_label_new (title));
+
+    adw_tab_page_set_title (page, title);
+  }
+
+  benchmark_run_layout (bench, case_name, GTK_WIDGET (bar), 1280, 0);
+}
+
+static void
+run_indicators_case (Benchmark *bench,
+                     int        n_pages)
+{
+  g_autofree char *case_name =
+    g_strdup_printf ("%d indicators, %s", n_pages, get_path_name ());
+  g_autoptr (GtkStack) stack = NULL;
+  GtkWidget *switcher;
+  int i;
+
+  stack = g_object_ref_sink (GTK_STACK (gtk_stack_new ()));
+  switcher = adw_view_switcher_new ();
+  adw_view_switcher_set_policy (ADW_VIEW_SWITCHER (switcher),
+                                ADW_VIEW_SWITCHER_POLICY_WIDE);
+  adw_view_switcher_set_stack (ADW_VIEW_SWITCHER (switcher), stack);
+
+  for (i = 0; i < n_pages; i++) {
+    g_autofree char *name = g_strdup_printf ("page%d", i);
+    GtkStackPage *page = gtk_stack_add_titled (stack, gtk_label_new (name),
+                                               name, name);
+
+    gtk_stack_page_set_icon_name (page, "go-home-symbolic");
+
+    /* The visible page doesn't show its indicator */
+    gtk_stack_page_set_needs_attention (page, TRUE);
+  }
+
+  benchmark_run_layout (bench, case_name, switcher, 1280, 0);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  Benchmark *bench = benchmark_new ("fade", &argc, &argv);
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++) {
+    run_tabs_case (bench, sizes[i]);
+    run_indicators_case (bench, sizes[i]);
+  }
+
+  return benchmark_finish (bench);
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "benchmark.h"
+
+#include "adw-frame-clock-private.h"
+
+#define FRAME_USEC 16667
+#define WIDTH 360
+#define HEIGHT 640
+#define MAX_FRAMES 1000
+
+static const int sizes[] = { 2, 10, 50 };
+
+/* Navigating runs the same transition as finishing a swipe. Each frame is
+ * stepped on the virtual clock and then laid out and snapshot the way the
+ * frame clock would do it. */
+static void
+run_case (Benchmark *bench,
+          int        n_children)
+{
+  g_autofree char *case_name = g_strdup_printf ("%d children", n_children);
+  AdwLeaflet *leaflet;
+  GtkWidget *window;
+  g_autoptr (GdkPaintable) paintable = NULL;
+  gint64 frame_time = 0;
+  int n_frames = 0, n_transitions = 0;
+  int i;
+
+  leaflet = ADW_LEAFLET (adw_leaflet_new ());
+  adw_leaflet_set_can_swipe_back (leaflet, TRUE);
+  adw_leaflet_set_can_swipe_forward (leaflet, TRUE);
+
+  for (i = 0; i < n_children; i++) {
+    g_autofree char *label = g_strdup_printf ("Child %d", i);
+    GtkWidget *child = gtk_label_new (label);
+
+    /* Wider than the window, so that the leaflet is folded */
+    gtk_widget_set_size_request (child, WIDTH, -1);
+
+    adw_leaflet_append (leaflet, child);
+  }
+
+  window = benchmark_show (bench, GTK_WIDGET (leaflet), WIDTH, HEIGHT);
+  paintable = gtk_widget_paintable_new (GTK_WIDGET (leaflet));
+
+  for (i = 0; i < benchmark_get_iterations (bench); i++) {
+    AdwNavigationDirection direction =
+      (i / (n_children - 1)) % 2 ? ADW_NAVIGATION_DIRECTION_BACK :
+                                   ADW_NAVIGATION_DIRECTION_FORWARD;
+
+    if (!adw_leaflet_navigate (leaflet, direction))
+      continue;
+
+    n_transitions++;
+
+    while (adw_frame_clock_get_n_tick_callbacks () > 0) {
+      GtkSnapshot *snapshot;
+      GskRenderNode *node;
+      gint64 start;
+
+      if (n_frames > MAX_FRAMES * n_transitions)
+        g_error ("The transition doesn't finish");
+
+      start = g_get_monotonic_time ();
+
+      adw_frame_clock_advance (FRAME_USEC);
+
+      gtk_widget_measure (GTK_WIDGET (leaflet), GTK_ORIENTATION_HORIZONTAL, -1,
+                          NULL, NULL, NULL, NULL);
+      gtk_widget_allocate (GTK_WIDGET (leaflet), WIDTH, HEIGHT, -1, NULL);
+
+      snapshot = gtk_snapshot_new ();
+      gdk_paintable_snapshot (paintable, snapshot, WIDTH, HEIGHT);
+      node = gtk_snapshot_free_to_node (snapshot);
+
+      frame_time += g_get_monotonic_time () - start;
+      n_frames++;
+
+      g_clear_pointer (&node, gsk_render_node_unref);
+    }
+  }
+
+  if (n_frames > 0) {
+    benchmark_add_result (bench, case_name, "frame",
+                          (double) frame_time / n_frames, "usec");
+    benchmark_add_result (bench, case_name, "frames-per-transition",
+                          (double) n_frames / n_transitions, "frames");
+  }
+
+  benchmark_hide (bench, window);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  Benchmark *bench;
+  guint i;
+
+  bench = benchmark_new ("leaflet", &argc, &argv);
+
+  g_object_set (gtk_settings_get_default (),
+                "gtk-enable-animations", TRUE,
+                NULL);
+  adw_frame_clock_set_virtual (TRUE);
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++)
+    run_case (bench, sizes[i]);
+
+  return benchmark_finish (bench);
+}
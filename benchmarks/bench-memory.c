@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "benchmark.h"
+
+#include "adw-instance-stats-private.h"
+
+static const int sizes[] = { 1000, 10000 };
+
+typedef GtkWidget *(*CreateFunc) (int n_items);
+
+typedef struct {
+  gsize widgets;
+  gsize css_nodes;
+  gsize render_nodes;
+} RetainedSizes;
+
+static void
+get_sizes (RetainedSizes *sizes)
+{
+  GType css_node_type = g_type_from_name ("GtkCssNode");
+
+  sizes->widgets = adw_instance_stats_get_size (GTK_TYPE_WIDGET, NULL);
+  sizes->css_nodes = css_node_type ? adw_instance_stats_get_size (css_node_type, NULL) : 0;
+  sizes->render_nodes = adw_instance_stats_get_size (GSK_TYPE_RENDER_NODE, NULL);
+}
+
+static GtkWidget *
+create_rows (int n_items)
+{
+  GtkWidget *list = gtk_list_box_new ();
+  int i;
+
+  for (i = 0; i < n_items; i++) {
+    g_autofree char *title = g_strdup_printf ("Row %d", i);
+    GtkWidget *row = adw_action_row_new ();
+
+    adw_preferences_row_set_title (ADW_PREFERENCES_ROW (row), title);
+    adw_action_row_set_subtitle (ADW_ACTION_ROW (row), "Subtitle");
+    gtk_list_box_append (GTK_LIST_BOX (list), row);
+  }
+
+  return list;
+}
+
+static GtkWidget *
+create_tabs (int n_items)
+{
+  AdwTabView *view = adw_tab_view_new ();
+  AdwTabBar *bar = adw_tab_bar_new ();
+  GtkWidget *box = gtk_box_new (GTK_ORIENTATION_VERTICAL, 0);
+  int i;
+
+  adw_tab_bar_set_autohide (bar, FALSE);
+  adw_tab_bar_set_view (bar, view);
+
+  for (i = 0; i < n_items; i++) {
+    g_autofree char *title = g_strdup_printf ("Tab %d", i);
+    AdwTabPage *page = adw_tab_view_append (view, gtk_label_new (NULL));
+
+    adw_tab_page_set_title (page, title);
+  }
+
+  gtk_box_append (GTK_BOX (box), GTK_WIDGET (bar));
+  gtk_box_append (GTK_BOX (box), GTK_WIDGET (view));
+
+  return box;
+}
+
+static GtkWidget *
+create_carousel_pages (int n_items)
+{
+  GtkWidget *carousel = adw_carousel_new ();
+  int i;
+
+  for (i = 0; i < n_items; i++)
+    adw_carousel_append (ADW_CAROUSEL (carousel), gtk_label_new ("Page"));
+
+  return carousel;
+}
+
+static GtkWidget *
+create_avatars (int n_items)
+{
+  GtkWidget *box = gtk_box_new (GTK_ORIENTATION_VERTICAL, 0);
+  int i;
+
+  for (i = 0; i < n_items; i++) {
+    g_autofree char *name = g_strdup_printf ("Contact %d", i);
+
+    gtk_box_append (GTK_BOX (box), adw_avatar_new (32, name, TRUE));
+  }
+
+  return box;
+}
+
+/* Compares the retained sizes before creating the widgets and after showing
+ * and drawing them once, which is when they create their CSS and render
+ * nodes. */
+static void
+run_case (Benchmark  *bench,
+          const char *name,
+          CreateFunc  create_func,
+          int         n_items)
+{
+  g_autofree char *case_name = g_strdup_printf ("%d %s", n_items, name);
+  g_autoptr (GdkPaintable) paintable = NULL;
+  GtkSnapshot *snapshot;
+  GskRenderNode *node;
+  GtkWidget *widget, *window;
+  RetainedSizes before, after;
+
+  get_sizes (&before);
+
+  widget = create_func (n_items);
+  window = benchmark_show (bench, widget, 640, 480);
+
+  paintable = gtk_widget_paintable_new (widget);
+  snapshot = gtk_snapshot_new ();
+  gdk_paintable_snapshot (paintable, snapshot, 640, 480);
+  node = gtk_snapshot_free_to_node (snapshot);
+
+  get_sizes (&after);
+
+  benchmark_add_result (bench, case_name, "widgets",
+                        ((double) after.widgets - before.widgets) / n_items,
+                        "bytes");
+  benchmark_add_result (bench, case_name, "css-nodes",
+                        ((double) after.css_nodes - before.css_nodes) / n_items,
+                        "bytes");
+  benchmark_add_result (bench, case_name, "render-nodes",
+                        ((double) after.render_nodes - before.render_nodes) / n_items,
+                        "bytes");
+
+  g_clear_pointer (&node, gsk_render_node_unref);
+  g_clear_object (&paintable);
+
+  benchmark_hide (bench, window);
+
+  /* Anything still alive at this point has leaked */
+  get_sizes (&after);
+
+  benchmark_add_result (bench, case_name, "leaked-widgets",
+                        ((double) after.widgets - before.widgets), "bytes");
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  Benchmark *bench = benchmark_new ("memory", &argc, &argv);
+  guint i;
+
+  if (!adw_instance_stats_get_enabled ()) {
+    g_printerr ("Needs GOBJECT_DEBUG=instance-count\n");
+
+    return 77;
+  }
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++) {
+    if (benchmark_is_quick (bench) && sizes[i] > 1000)
+      continue;
+
+    run_case (bench, "rows", create_rows, sizes[i]);
+    run_case (bench, "tabs", create_tabs, sizes[i]);
+    run_case (bench, "carousel pages", create_carousel_pages, sizes[i]);
+    run_case (bench, "avatars", create_avatars, sizes[i]);
+  }
+
+  return benchmark_finish (bench);
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "benchmark.h"
+
+#define ROWS_PER_GROUP 50
+
+static const int sizes[] = { 100, 500, 1000, 5000 };
+
+static const char * const queries[] = { "row", "row 1", "row 42", "group 3", "nothing" };
+
+static GtkWidget *
+find_descendant (GtkWidget  *widget,
+                 GType       type,
+                 const char *icon_name)
+{
+  GtkWidget *child;
+
+  if (G_TYPE_CHECK_INSTANCE_TYPE (widget, type) &&
+      (!icon_name || !g_strcmp0 (gtk_button_get_icon_name (GTK_BUTTON (widget)), icon_name)))
+    return widget;
+
+  for (child = gtk_widget_get_first_child (widget);
+       child;
+       child = gtk_widget_get_next_sibling (child)) {
+    GtkWidget *found = find_descendant (child, type, icon_name);
+
+    if (found)
+      return found;
+  }
+
+  return NULL;
+}
+
+static AdwPreferencesPage *
+create_page (int n_rows)
+{
+  AdwPreferencesPage *page;
+  AdwPreferencesGroup *group = NULL;
+  int i;
+
+  page = ADW_PREFERENCES_PAGE (adw_preferences_page_new ());
+
+  for (i = 0; i < n_rows; i++) {
+    g_autofree char *title = g_strdup_printf ("Row %d", i);
+    g_autofree char *subtitle = g_strdup_printf ("Subtitle of row %d", i);
+    GtkWidget *row;
+
+    if (i % ROWS_PER_GROUP == 0) {
+      g_autofree char *group_title = g_strdup_printf ("Group %d", i / ROWS_PER_GROUP);
+
+      group = ADW_PREFERENCES_GROUP (adw_preferences_group_new ());
+      adw_preferences_group_set_title (group, group_title);
+      adw_preferences_page_add (page, group);
+    }
+
+    row = adw_action_row_new ();
+    adw_preferences_row_set_title (ADW_PREFERENCES_ROW (row), title);
+    adw_action_row_set_subtitle (ADW_ACTION_ROW (row), subtitle);
+    adw_preferences_group_add (group, row);
+  }
+
+  return page;
+}
+
+static void
+run_search (Benchmark  *bench,
+            const char *case_name,
+            int         n_rows)
+{
+  AdwPreferencesWindow *window;
+  GtkWidget *search_button, *search_entry;
+  gint64 search_time = 0;
+  int n_searches = 0;
+  int i;
+
+  window = ADW_PREFERENCES_WINDOW (adw_preferences_window_new ());
+  adw_preferences_window_add (window, create_page (n_rows));
+  gtk_window_present (GTK_WINDOW (window));
+
+  while (!gtk_widget_get_mapped (GTK_WIDGET (window)))
+    g_main_context_iteration (NULL, TRUE);
+
+  /* The search UI is internal, so drive it the way the user would */
+  search_button = find_descendant (GTK_WIDGET (window),
+                                   GTK_TYPE_TOGGLE_BUTTON,
+                                   "edit-find-symbolic");
+  search_entry = find_descendant (GTK_WIDGET (window),
+                                  GTK_TYPE_SEARCH_ENTRY,
+                                  NULL);
+  g_assert (search_button && search_entry);
+
+  gtk_toggle_button_set_active (GTK_TOGGLE_BUTTON (search_button), TRUE);
+
+  while (g_main_context_pending (NULL))
+    g_main_context_iteration (NULL, FALSE);
+
+  for (i = 0; i < benchmark_get_iterations (bench); i++) {
+    const char *query = queries[i % G_N_ELEMENTS (queries)];
+    gint64 start;
+
+    gtk_editable_set_text (GTK_EDITABLE (search_entry), query);
+
+    /* Don't wait for the entry's own delay */
+    start = g_get_monotonic_time ();
+    g_signal_emit_by_name (search_entry, "search-changed");
+    search_time += g_get_monotonic_time () - start;
+
+    n_searches++;
+  }
+
+  benchmark_add_result (bench, case_name, "search",
+                        (double) search_time / n_searches, "usec");
+
+  benchmark_hide (bench, GTK_WIDGET (window));
+}
+
+static void
+run_case (Benchmark *bench,
+          int        n_rows)
+{
+  g_autofree char *case_name = g_strdup_printf ("%d rows", n_rows);
+
+  run_search (bench, case_name, n_rows);
+
+  benchmark_run_layout (bench, case_name,
+                        GTK_WIDGET (create_page (n_rows)), 640, 480);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  Benchmark *bench = benchmark_new ("preferences-window", &argc, &argv);
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++) {
+    if (benchmark_is_quick (bench) && sizes[i] > 1000)
+      continue;
+
+    run_case (bench, sizes[i]);
+  }
+
+  return benchmark_finish (bench);
+}
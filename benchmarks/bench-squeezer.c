@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "benchmark.h"
+
+#define MIN_WIDTH 150
+#define MAX_WIDTH 1200
+#define WIDTH_STEP 10
+
+static const int sizes[] = { 2, 5, 20 };
+
+static void
+run_case (Benchmark *bench,
+          int        n_children)
+{
+  g_autofree char *case_name = g_strdup_printf ("%d children", n_children);
+  g_autoptr (AdwSqueezer) squeezer = NULL;
+  GtkWidget *window;
+  gint64 resize_time = 0;
+  int n_resizes = 0;
+  int i, width, min_width;
+
+  /* Keep it alive to use it in two windows */
+  squeezer = g_object_ref_sink (ADW_SQUEEZER (adw_squeezer_new ()));
+
+  /* From widest to narrowest, so that resizing switches between them */
+  for (i = 0; i < n_children; i++) {
+    g_autofree char *label = g_strdup_printf ("Child %d", i);
+    GtkWidget *child = gtk_label_new (label);
+
+    gtk_widget_set_size_request (child,
+                                 MAX_WIDTH - (MAX_WIDTH - MIN_WIDTH) * i / n_children,
+                                 -1);
+
+    adw_squeezer_add (squeezer, child);
+  }
+
+  benchmark_run_layout (bench, case_name, GTK_WIDGET (squeezer), 800, 0);
+
+  window = benchmark_show (bench, GTK_WIDGET (squeezer), 800, 0);
+
+  gtk_widget_measure (GTK_WIDGET (squeezer), GTK_ORIENTATION_HORIZONTAL, -1,
+                      &min_width, NULL, NULL, NULL);
+
+  for (i = 0; i < benchmark_get_iterations (bench); i++) {
+    for (width = min_width; width <= MAX_WIDTH; width += WIDTH_STEP) {
+      int height;
+      gint64 start;
+
+      start = g_get_monotonic_time ();
+      gtk_widget_measure (GTK_WIDGET (squeezer), GTK_ORIENTATION_VERTICAL, width,
+                          &height, NULL, NULL, NULL);
+      gtk_widget_allocate (GTK_WIDGET (squeezer), width, height, -1, NULL);
+      resize_time += g_get_monotonic_time () - start;
+
+      n_resizes++;
+    }
+  }
+
+  benchmark_add_result (bench, case_name, "resize",
+                        (double) resize_time / n_resizes, "usec");
+
+  benchmark_hide (bench, window);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  Benchmark *bench = benchmark_new ("squeezer", &argc, &argv);
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++)
+    run_case (bench, sizes[i]);
+
+  return benchmark_finish (bench);
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "benchmark.h"
+
+static const int sizes[] = { 10, 100, 1000, 5000 };
+
+static void
+run_case (Benchmark *bench,
+          int        n_tabs)
+{
+  g_autofree char *case_name = g_strdup_printf ("%d tabs", n_tabs);
+  g_autoptr (AdwTabView) view = NULL;
+  AdwTabBar *bar;
+  gint64 start;
+  int i;
+
+  view = g_object_ref_sink (ADW_TAB_VIEW (adw_tab_view_new ()));
+  bar = adw_tab_bar_new ();
+  adw_tab_bar_set_autohide (bar, FALSE);
+  adw_tab_bar_set_view (bar, view);
+
+  start = g_get_monotonic_time ();
+
+  for (i = 0; i < n_tabs; i++) {
+    g_autofree char *title = g_strdup_printf ("Tab %d", i);
+    AdwTabPage *page = adw_tab_view_append (view, gtk_label_new (title));
+
+    adw_tab_page_set_title (page, title);
+  }
+
+  benchmark_add_result (bench, case_name, "append",
+                        (double) (g_get_monotonic_time () - start) / n_tabs,
+                        "usec");
+
+  benchmark_run_layout (bench, case_name, GTK_WIDGET (bar), 1280, 0);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  Benchmark *bench = benchmark_new ("tab-box", &argc, &argv);
+  guint i;
+
+  for (i = 0; i < G_N_ELEMENTS (sizes); i++) {
+    if (benchmark_is_quick (bench) && sizes[i] > 1000)
+      continue;
+
+    run_case (bench, sizes[i]);
+  }
+
+  return benchmark_finish (bench);
+}
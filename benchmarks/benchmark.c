@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "benchmark.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DEFAULT_ITERATIONS 20
+#define SETTLE_TIMEOUT_USEC (10 * G_USEC_PER_SEC)
+
+/* Exit status meson treats as a skipped test */
+#define EXIT_SKIP 77
+
+struct _Benchmark
+{
+  char *name;
+  int iterations;
+  gboolean quick;
+  char *output;
+
+  GString *results;
+  guint n_results;
+};
+
+static void
+append_json_string (GString    *string,
+                    const char *value)
+{
+  const char *p;
+
+  g_string_append_c (string, '"');
+
+  for (p = value; *p; p++) {
+    if (*p == '"' || *p == '\\')
+      g_string_append_c (string, '\\');
+
+    g_string_append_c (string, *p);
+  }
+
+  g_string_append_c (string, '"');
+}
+
+static void
+iterate_until_idle (void)
+{
+  while (g_main_context_pending (NULL))
+    g_main_context_iteration (NULL, FALSE);
+}
+
+/* Exits with EXIT_SKIP if there's no display to run on */
+Benchmark *
+benchmark_new (const char   *name,
+               int          *argc,
+               char       ***argv)
+{
+  g_autoptr (GOptionContext) context = NULL;
+  g_autoptr (GError) error = NULL;
+  Benchmark *self;
+  int iterations = DEFAULT_ITERATIONS;
+  gboolean quick = FALSE;
+  char *output = NULL;
+  GOptionEntry entries[] = {
+    { "iterations", 'n', 0, G_OPTION_ARG_INT, &iterations, "Number of iterations per case", "N" },
+    { "quick", 'q', 0, G_OPTION_ARG_NONE, &quick, "Skip the largest cases", NULL },
+    { "output", 'o', 0, G_OPTION_ARG_FILENAME, &output, "Write the results to FILE instead of stdout", "FILE" },
+    { NULL }
+  };
+
+  context = g_option_context_new (NULL);
+  g_option_context_add_main_entries (context, entries, NULL);
+
+  if (!g_option_context_parse (context, argc, argv, &error)) {
+    g_printerr ("%s\n", error->message);
+
+    exit (EXIT_FAILURE);
+  }
+
+  /* Keep the results comparable between machines unless asked otherwise */
+  g_setenv ("GSK_RENDERER", "cairo", FALSE);
+  g_setenv ("GTK_A11Y", "none", FALSE);
+
+  if (!gtk_init_check ()) {
+    g_printerr ("No display available, skipping\n");
+
+    exit (EXIT_SKIP);
+  }
+
+  adw_init ();
+
+  /* Benchmarks that need animations drive them with the virtual clock */
+  g_object_set (gtk_settings_get_default (),
+                "gtk-enable-animations", FALSE,
+                NULL);
+
+  self = g_new0 (Benchmark, 1);
+  self->name = g_strdup (name);
+  self->iterations = MAX (iterations, 1);
+  self->quick = quick;
+  self->output = output;
+  self->results = g_string_new (NULL);
+
+  return self;
+}
+
+int
+benchmark_finish (Benchmark *self)
+{
+  g_autoptr (GString) json = g_string_new ("{\n  \"benchmark\": ");
+  int status = EXIT_SUCCESS;
+
+  append_json_string (json, self->name);
+  g_string_append_printf (json,
+                          ",\n"
+                          "  \"adwaita_version\": \"%s\",\n"
+                          "  \"gtk_version\": \"%u.%u.%u\",\n"
+                          "  \"renderer\": ",
+                          ADW_VERSION_S,
+                          gtk_get_major_version (),
+                          gtk_get_minor_version (),
+                          gtk_get_micro_version ());
+  append_json_string (json, g_getenv ("GSK_RENDERER"));
+  g_string_append_printf (json,
+                          ",\n"
+                          "  \"iterations\": %d,\n"
+                          "  \"results\": [\n%s\n  ]\n}\n",
+                          self->iterations,
+                          self->results->str);
+
+  if (self->output) {
+    g_autoptr (GError) error = NULL;
+
+    if (!g_file_set_contents (self->output, json->str, json->len, &error)) {
+      g_printerr ("Couldn't write %s: %s\n", self->output, error->message);
+      status = EXIT_FAILURE;
+    }
+  } else {
+    fputs (json->str, stdout);
+  }
+
+  g_string_free (self->results, TRUE);
+  g_free (self->output);
+  g_free (self->name);
+  g_free (self);
+
+  return status;
+}
+
+gboolean
+benchmark_is_quick (Benchmark *self)
+{
+  return self->quick;
+}
+
+int
+benchmark_get_iterations (Benchmark *self)
+{
+  return self->iterations;
+}
+
+GtkWidget *
+benchmark_show (Benchmark *self,
+                GtkWidget *widget,
+                int        width,
+                int        height)
+{
+  GtkWidget *window = gtk_window_new ();
+  gint64 deadline = g_get_monotonic_time () + SETTLE_TIMEOUT_USEC;
+
+  gtk_window_set_default_size (GTK_WINDOW (window), width, height);
+  gtk_window_set_child (GTK_WINDOW (window), widget);
+  gtk_window_present (GTK_WINDOW (window));
+
+  while (!gtk_widget_get_mapped (widget)) {
+    if (g_get_monotonic_time () > deadline) {
+      g_printerr ("Timed out waiting for the window to be mapped\n");
+
+      exit (EXIT_FAILURE);
+    }
+
+    g_main_context_iteration (NULL, TRUE);
+  }
+
+  iterate_until_idle ();
+
+  return window;
+}
+
+void
+benchmark_hide (Benchmark *self,
+                GtkWidget *window)
+{
+  gtk_window_destroy (GTK_WINDOW (window));
+
+  iterate_until_idle ();
+}
+
+/* Times each phase of a frame separately. Size requests and render nodes are
+ * invalidated before every iteration, so that cached results aren't measured
+ * instead of the actual work. */
+void
+benchmark_run_layout (Benchmark  *self,
+                      const char *case_name,
+                      GtkWidget  *widget,
+                      int         width,
+                      int         height)
+{
+  GtkWidget *window = benchmark_show (self, widget, width, height);
+  g_autoptr (GdkPaintable) paintable = gtk_widget_paintable_new (widget);
+  GskRenderer *renderer = gtk_native_get_renderer (GTK_NATIVE (window));
+  gint64 measure_time = 0, allocate_time = 0;
+  gint64 snapshot_time = 0, render_time = 0;
+  int min_width, min_height;
+  int i;
+
+  /* Never allocate less than the minimum size */
+  gtk_widget_measure (widget, GTK_ORIENTATION_HORIZONTAL, -1,
+                      &min_width, NULL, NULL, NULL);
+  width = MAX (width, min_width);
+  gtk_widget_measure (widget, GTK_ORIENTATION_VERTICAL, width,
+                      &min_height, NULL, NULL, NULL);
+  height = MAX (height, min_height);
+
+  for (i = 0; i < self->iterations; i++) {
+    GtkSnapshot *snapshot;
+    GskRenderNode *node;
+    gint64 start;
+
+    gtk_widget_queue_resize (widget);
+
+    start = g_get_monotonic_time ();
+    gtk_widget_measure (widget, GTK_ORIENTATION_HORIZONTAL, -1,
+                        NULL, NULL, NULL, NULL);
+    gtk_widget_measure (widget, GTK_ORIENTATION_VERTICAL, width,
+                        NULL, NULL, NULL, NULL);
+    measure_time += g_get_monotonic_time () - start;
+
+    start = g_get_monotonic_time ();
+    gtk_widget_allocate (widget, width, height, -1, NULL);
+    allocate_time += g_get_monotonic_time () - start;
+
+    gtk_widget_queue_draw (widget);
+
+    start = g_get_monotonic_time ();
+    snapshot = gtk_snapshot_new ();
+    gdk_paintable_snapshot (paintable, snapshot, width, height);
+    node = gtk_snapshot_free_to_node (snapshot);
+    snapshot_time += g_get_monotonic_time () - start;
+
+    if (node) {
+      GdkTexture *texture;
+
+      start = g_get_monotonic_time ();
+      texture = gsk_renderer_render_texture (renderer, node,
+                                             &GRAPHENE_RECT_INIT (0, 0, width, height));
+      render_time += g_get_monotonic_time () - start;
+
+      g_object_unref (texture);
+      gsk_render_node_unref (node);
+    }
+  }
+
+  benchmark_add_result (self, case_name, "measure", (double) measure_time / self->iterations, "usec");
+  benchmark_add_result (self, case_name, "allocate", (double) allocate_time / self->iterations, "usec");
+  benchmark_add_result (self, case_name, "snapshot", (double) snapshot_time / self->iterations, "usec");
+  benchmark_add_result (self, case_name, "render", (double) render_time / self->iterations, "usec");
+
+  benchmark_hide (self, window);
+}
+
+void
+benchmark_add_result (Benchmark  *self,
+                      const char *case_name,
+                      const char *metric,
+                      double      value,
+                      const char *unit)
+{
+  char buffer[G_ASCII_DTOSTR_BUF_SIZE];
+
+  if (self->n_results++ > 0)
+    g_string_append (self->results, ",\n");
+
+  g_string_append (self->results, "    { \"case\": ");
+  append_json_string (self->results, case_name);
+  g_string_append (self->results, ", \"metric\": ");
+  append_json_string (self->results, metric);
+  g_string_append_printf (self->results, ", \"value\": %s, \"unit\": ",
+                          g_ascii_dtostr (buffer, sizeof (buffer), value));
+  append_json_string (self->results, unit);
+  g_string_append (self->results, " }");
+
+  /* Progress for whoever is watching, the results go to stdout */
+  g_printerr ("%s %s %s: %.1f %s\n", self->name, case_name, metric, value, unit);
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#pragma once
+
+#include <adwaita.h>
+
+G_BEGIN_DECLS
+
+typedef struct _Benchmark Benchmark;
+
+Benchmark *benchmark_new    (const char   *name,
+                             int          *argc,
+                             char       ***argv);
+int        benchmark_finish (Benchmark    *self);
+
+gboolean   benchmark_is_quick       (Benchmark *self);
+int        benchmark_get_iterations (Benchmark *self);
+
+GtkWidget *benchmark_show (Benchmark *self,
+                           GtkWidget *widget,
+                           int        width,
+                           int        height);
+void       benchmark_hide (Benchmark *self,
+                           GtkWidget *window);
+
+void benchmark_run_layout (Benchmark  *self,
+                           const char *case_name,
+                           GtkWidget  *widget,
+                           int         width,
+                           int         height);
+
+void benchmark_add_result (Benchmark  *self,
+                           const char *case_name,
+                           const char *metric,
+                           double      value,
+                           const char *unit);
+
+G_END_DECLS
@@ -40,9 +40,16 @@ void          adw_animation_unref (AdwAnimation *self);
 void adw_animation_start (AdwAnimation *self);
 void adw_animation_stop  (AdwAnimation *self);
 
+void adw_animation_set_essential (AdwAnimation *self,
+                                  gboolean      essential);
+
 GtkWidget *adw_animation_get_widget (AdwAnimation *self);
 double     adw_animation_get_value  (AdwAnimation *self);
 
+GList *adw_animation_get_running (void);
+
+gint64 adw_animation_get_frame_interval (GtkWidget *widget);
+
 G_DEFINE_AUTOPTR_CLEANUP_FUNC (AdwAnimation, adw_animation_unref)
 
 double adw_lerp (double a,
@@ -8,8 +8,29 @@
 
 #include "adw-animation-private.h"
 
+#include "adw-frame-clock-private.h"
+
 G_DEFINE_BOXED_TYPE (AdwAnimation, adw_animation, adw_animation_ref, adw_animation_unref)
 
+/* For the inspector */
+static GList *running_animations;
+
+/* Rate at which animations in unfocused windows are updated when
+ * adw_set_throttle_inactive_windows() is enabled */
+#define INACTIVE_FRAME_RATE 10
+
+static guint frame_rate_limit;
+static gboolean reduced_motion;
+static gboolean throttle_inactive_windows;
+
+enum {
+  ANIMATIONS_UNKNOWN,
+  ANIMATIONS_DISABLED,
+  ANIMATIONS_ENABLED,
+};
+
+G_DEFINE_QUARK (adw-enable-animations, adw_enable_animations)
+
 struct _AdwAnimation
 {
   gatomicrefcount ref_count;
@@ -25,6 +46,7 @@ struct _AdwAnimation
   gint64 start_time; /* ms */
   guint tick_cb_id;
   gulong unmap_cb_id;
+  GList running_link;
 
   AdwAnimationEasingFunc easing_func;
   AdwAnimationValueCallback value_cb;
@@ -32,6 +54,7 @@ struct _AdwAnimation
   gpointer user_data;
 
   gboolean is_done;
+  gboolean essential;
 };
 
 static void
@@ -57,11 +80,12 @@ tick_cb (GtkWidget     *widget,
          GdkFrameClock *frame_clock,
          AdwAnimation  *self)
 {
-  gint64 frame_time = gdk_frame_clock_get_frame_time (frame_clock) / 1000; /* ms */
+  gint64 frame_time = adw_frame_clock_get_frame_time (widget) / 1000; /* ms */
   double t = (double) (frame_time - self->start_time) / self->duration;
 
   if (t >= 1) {
     self->tick_cb_id = 0;
+    running_animations = g_list_remove_link (running_animations, &self->running_link);
 
     set_value (self, self->value_to);
 
@@ -80,6 +104,28 @@ tick_cb (GtkWidget     *widget,
   return G_SOURCE_CONTINUE;
 }
 
+static gboolean
+is_window_hidden (GtkWidget *widget)
+{
+  GtkRoot *root;
+  GdkSurface *surface;
+
+  if (!throttle_inactive_windows)
+    return FALSE;
+
+  root = gtk_widget_get_root (widget);
+
+  if (!GTK_IS_WINDOW (root))
+    return FALSE;
+
+  surface = gtk_native_get_surface (GTK_NATIVE (root));
+
+  if (!GDK_IS_TOPLEVEL (surface))
+    return FALSE;
+
+  return !!(gdk_toplevel_get_state (GDK_TOPLEVEL (surface)) & GDK_TOPLEVEL_STATE_MINIMIZED);
+}
+
 static void
 adw_animation_free (AdwAnimation *self)
 {
@@ -120,6 +166,8 @@ adw_animation_new (GtkWidget                 *widget,
 
   self->value = from;
   self->is_done = FALSE;
+  self->essential = TRUE;
+  self->running_link.data = self;
 
   return self;
 }
@@ -148,8 +196,11 @@ adw_animation_start (AdwAnimation *self)
 {
   g_return_if_fail (self != NULL);
 
+  /* Widgets don't need to be shown for the virtual clock used by tests */
   if (!adw_get_enable_animations (self->widget) ||
-      !gtk_widget_get_mapped (self->widget) ||
+      (reduced_motion && !self->essential) ||
+      (!gtk_widget_get_mapped (self->widget) && !adw_frame_clock_get_virtual ()) ||
+      is_window_hidden (self->widget) ||
       self->duration <= 0) {
     set_value (self, self->value_to);
 
@@ -158,7 +209,7 @@ adw_animation_start (AdwAnimation *self)
     return;
   }
 
-  self->start_time = gdk_frame_clock_get_frame_time (gtk_widget_get_frame_clock (self->widget)) / 1000;
+  self->start_time = adw_frame_clock_get_frame_time (self->widget) / 1000;
 
   if (self->tick_cb_id)
     return;
@@ -166,7 +217,8 @@ adw_animation_start (AdwAnimation *self)
   self->unmap_cb_id =
     g_signal_connect_swapped (self->widget, "unmap",
                               G_CALLBACK (adw_animation_stop), self);
-  self->tick_cb_id = gtk_widget_add_tick_callback (self->widget, (GtkTickCallback) tick_cb, self, NULL);
+  self->tick_cb_id = adw_frame_clock_add_tick_callback (self->widget, (GtkTickCallback) tick_cb, self, NULL);
+  running_animations = g_list_concat (&self->running_link, running_animations);
 }
 
 void
@@ -175,8 +227,9 @@ adw_animation_stop (AdwAnimation *self)
   g_return_if_fail (self != NULL);
 
   if (self->tick_cb_id) {
-    gtk_widget_remove_tick_callback (self->widget, self->tick_cb_id);
+    adw_frame_clock_remove_tick_callback (self->widget, self->tick_cb_id);
     self->tick_cb_id = 0;
+    running_animations = g_list_remove_link (running_animations, &self->running_link);
   }
 
   if (self->unmap_cb_id) {
@@ -195,6 +248,17 @@ adw_animation_get_value (AdwAnimation *self)
   return self->value;
 }
 
+/* Non-essential animations only decorate a change that is visible without
+ * them, and are skipped when reduced motion is requested */
+void
+adw_animation_set_essential (AdwAnimation *self,
+                             gboolean      essential)
+{
+  g_return_if_fail (self != NULL);
+
+  self->essential = !!essential;
+}
+
 GtkWidget *
 adw_animation_get_widget (AdwAnimation *self)
 {
@@ -203,6 +267,55 @@ adw_animation_get_widget (AdwAnimation *self)
   return self->widget;
 }
 
+GList *
+adw_animation_get_running (void)
+{
+  return running_animations;
+}
+
+/* Returns the minimum time between two updates of an animation running on
+ * @widget, in microseconds, 0 if it's not limited, or -1 if it must not be
+ * updated at all because the window is minimized. Animation time still passes
+ * meanwhile, so such animations aren't paused. */
+gint64
+adw_animation_get_frame_interval (GtkWidget *widget)
+{
+  guint frame_rate = frame_rate_limit;
+  GtkRoot *root;
+
+  if (throttle_inactive_windows) {
+    if (is_window_hidden (widget))
+      return -1;
+
+    root = gtk_widget_get_root (widget);
+
+    if (GTK_IS_WINDOW (root) && !gtk_window_is_active (GTK_WINDOW (root)))
+      frame_rate = frame_rate ? MIN (frame_rate, INACTIVE_FRAME_RATE) : INACTIVE_FRAME_RATE;
+  }
+
+  if (!frame_rate)
+    return 0;
+
+  return G_USEC_PER_SEC / frame_rate;
+}
+
+static gpointer
+update_enable_animations (GtkSettings *settings)
+{
+  gboolean enable_animations = TRUE;
+  gpointer value;
+
+  g_object_get (settings,
+                "gtk-enable-animations", &enable_animations,
+                NULL);
+
+  value = GINT_TO_POINTER (enable_animations ? ANIMATIONS_ENABLED : ANIMATIONS_DISABLED);
+
+  g_object_set_qdata (G_OBJECT (settings), adw_enable_animations_quark (), value);
+
+  return value;
+}
+
 /**
  * adw_get_enable_animations:
  * @widget: a `GtkWidget`
@@ -219,15 +332,134 @@ adw_animation_get_widget (AdwAnimation *self)
 gboolean
 adw_get_enable_animations (GtkWidget *widget)
 {
-  gboolean enable_animations = TRUE;
+  GtkSettings *settings;
+  gpointer value;
 
   g_assert (GTK_IS_WIDGET (widget));
 
-  g_object_get (gtk_widget_get_settings (widget),
-                "gtk-enable-animations", &enable_animations,
-                NULL);
+  /* This is called every time an animation starts, so cache the setting on
+   * the settings object and only update it when it changes */
+  settings = gtk_widget_get_settings (widget);
+  value = g_object_get_qdata (G_OBJECT (settings), adw_enable_animations_quark ());
+
+  if (GPOINTER_TO_INT (value) == ANIMATIONS_UNKNOWN) {
+    g_signal_connect (settings, "notify::gtk-enable-animations",
+                      G_CALLBACK (update_enable_animations), NULL);
+
+    value = update_enable_animations (settings);
+  }
+
+  return GPOINTER_TO_INT (value) == ANIMATIONS_ENABLED;
+}
 
-  return enable_animations;
+/**
+ * adw_get_animation_frame_rate_limit:
+ *
+ * Gets the maximum rate at which animations are updated.
+ *
+ * Returns: the frame rate limit, in frames per second, or 0 if unlimited
+ *
+ * Since: 1.0
+ */
+guint
+adw_get_animation_frame_rate_limit (void)
+{
+  return frame_rate_limit;
+}
+
+/**
+ * adw_set_animation_frame_rate_limit:
+ * @frame_rate: the frame rate limit, in frames per second, or 0
+ *
+ * Sets the maximum rate at which animations are updated.
+ *
+ * This affects animations, swipe deceleration and transitions of all
+ * Libadwaita widgets. They still last as long as they would otherwise, but
+ * skip frames to stay under the limit. For example, an application can limit
+ * animations to 30 frames per second when running on battery.
+ *
+ * If @frame_rate is 0, animations are updated every frame.
+ *
+ * Since: 1.0
+ */
+void
+adw_set_animation_frame_rate_limit (guint frame_rate)
+{
+  frame_rate_limit = frame_rate;
+}
+
+/**
+ * adw_get_reduce_motion:
+ *
+ * Gets whether non-essential animations are skipped.
+ *
+ * Returns: whether non-essential animations are skipped
+ *
+ * Since: 1.0
+ */
+gboolean
+adw_get_reduce_motion (void)
+{
+  return reduced_motion;
+}
+
+/**
+ * adw_set_reduce_motion:
+ * @reduce_motion: whether to skip non-essential animations
+ *
+ * Sets whether non-essential animations are skipped.
+ *
+ * Non-essential animations are the ones that only decorate a change, such as
+ * tabs appearing and disappearing in [class@TabBar], or carousel indicators
+ * growing and shrinking. Animations that convey where content goes, such as
+ * transitions and swipes, are kept.
+ *
+ * To disable all animations, use [property@Gtk.Settings:gtk-enable-animations]
+ * instead.
+ *
+ * Since: 1.0
+ */
+void
+adw_set_reduce_motion (gboolean reduce_motion)
+{
+  reduced_motion = !!reduce_motion;
+}
+
+/**
+ * adw_get_throttle_inactive_windows:
+ *
+ * Gets whether animations are throttled in inactive windows.
+ *
+ * Returns: whether animations are throttled in inactive windows
+ *
+ * Since: 1.0
+ */
+gboolean
+adw_get_throttle_inactive_windows (void)
+{
+  return throttle_inactive_windows;
+}
+
+/**
+ * adw_set_throttle_inactive_windows:
+ * @throttle: whether to throttle animations in inactive windows
+ *
+ * Sets whether animations are throttled in inactive windows.
+ *
+ * If @throttle is `TRUE`, animations in windows that don't have focus are
+ * updated at a low frame rate, and animations in minimized windows aren't
+ * updated at all, or are skipped entirely if they haven't started yet.
+ *
+ * Animations in minimized windows aren't paused: their time keeps running, so
+ * once the window is restored, they continue from where they would have been,
+ * or finish right away if they would have ended in the meantime.
+ *
+ * Since: 1.0
+ */
+void
+adw_set_throttle_inactive_windows (gboolean throttle)
+{
+  throttle_inactive_windows = !!throttle;
 }
 
 /**
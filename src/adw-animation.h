@@ -19,6 +19,21 @@ G_BEGIN_DECLS
 ADW_AVAILABLE_IN_ALL
 gboolean adw_get_enable_animations (GtkWidget *widget);
 
+ADW_AVAILABLE_IN_ALL
+guint adw_get_animation_frame_rate_limit (void);
+ADW_AVAILABLE_IN_ALL
+void  adw_set_animation_frame_rate_limit (guint frame_rate);
+
+ADW_AVAILABLE_IN_ALL
+gboolean adw_get_reduce_motion (void);
+ADW_AVAILABLE_IN_ALL
+void     adw_set_reduce_motion (gboolean reduce_motion);
+
+ADW_AVAILABLE_IN_ALL
+gboolean adw_get_throttle_inactive_windows (void);
+ADW_AVAILABLE_IN_ALL
+void     adw_set_throttle_inactive_windows (gboolean throttle);
+
 ADW_AVAILABLE_IN_ALL
 double adw_ease_out_cubic (double t);
 
@@ -90,6 +90,7 @@ animate (AdwCarouselIndicatorDots *self,
                        (AdwAnimationDoneCallback) done_cb,
                        self);
 
+  adw_animation_set_essential (self->animation, FALSE);
   adw_animation_start (self->animation);
 }
 
@@ -89,6 +89,7 @@ animate (AdwCarouselIndicatorLines *self,
                        (AdwAnimationDoneCallback) done_cb,
                        self);
 
+  adw_animation_set_essential (self->animation, FALSE);
   adw_animation_start (self->animation);
 }
 
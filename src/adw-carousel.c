@@ -9,6 +9,7 @@
 #include "adw-carousel.h"
 
 #include "adw-animation-private.h"
+#include "adw-layout-stats-private.h"
 #include "adw-navigation-direction.h"
 #include "adw-swipe-tracker.h"
 #include "adw-swipeable.h"
@@ -46,6 +47,12 @@ typedef struct {
 
   gboolean shift_position;
   AdwAnimation *resize_animation;
+
+  /* Size along the carousel orientation, measured for measured_for_size */
+  gboolean measured;
+  int measured_for_size;
+  int min_size;
+  int nat_size;
 } ChildInfo;
 
 struct _AdwCarousel
@@ -67,6 +74,7 @@ struct _AdwCarousel
   AdwSwipeTracker *tracker;
 
   gboolean allow_scroll_wheel;
+  gboolean uniform_pages;
 
   double position_shift;
 
@@ -95,10 +103,11 @@ enum {
   PROP_ALLOW_SCROLL_WHEEL,
   PROP_ALLOW_LONG_SWIPES,
   PROP_REVEAL_DURATION,
+  PROP_UNIFORM_PAGES,
 
   /* GtkOrientable */
   PROP_ORIENTATION,
-  LAST_PROP = PROP_REVEAL_DURATION + 1,
+  LAST_PROP = PROP_UNIFORM_PAGES + 1,
 };
 
 static GParamSpec *props[LAST_PROP];
@@ -213,6 +222,21 @@ get_range (AdwCarousel *self,
     *upper = child ? child->snap_point : 0;
 }
 
+static void
+update_snap_points (AdwCarousel *self)
+{
+  GList *l;
+  double snap_point = 0;
+
+  for (l = self->children; l; l = l->next) {
+    ChildInfo *child = l->data;
+
+    child->snap_point = snap_point + child->size - 1;
+
+    snap_point += child->size;
+  }
+}
+
 static GtkWidget *
 get_page_at_position (AdwCarousel *self,
                       double       position)
@@ -537,6 +561,34 @@ scroll_cb (AdwCarousel              *self,
   return GDK_EVENT_STOP;
 }
 
+static void
+invalidate_child_sizes (AdwCarousel *self)
+{
+  GList *l;
+
+  for (l = self->children; l; l = l->next) {
+    ChildInfo *child_info = l->data;
+
+    child_info->measured = FALSE;
+  }
+}
+
+static void
+measure_child (AdwCarousel *self,
+               ChildInfo   *child_info,
+               int          for_size)
+{
+  if (child_info->measured && child_info->measured_for_size == for_size)
+    return;
+
+  gtk_widget_measure (child_info->widget, self->orientation, for_size,
+                      &child_info->min_size, &child_info->nat_size,
+                      NULL, NULL);
+
+  child_info->measured = TRUE;
+  child_info->measured_for_size = for_size;
+}
+
 static void
 adw_carousel_measure (GtkWidget      *widget,
                       GtkOrientation  orientation,
@@ -549,6 +601,8 @@ adw_carousel_measure (GtkWidget      *widget,
   AdwCarousel *self = ADW_CAROUSEL (widget);
   GList *children;
 
+  ADW_LAYOUT_STATS_MEASURE (widget);
+
   if (minimum)
     *minimum = 0;
   if (natural)
@@ -559,6 +613,10 @@ adw_carousel_measure (GtkWidget      *widget,
   if (natural_baseline)
     *natural_baseline = -1;
 
+  /* We only get measured again after a resize was queued, which may have
+   * come from a child, so the sizes measured in size_allocate() are stale. */
+  invalidate_child_sizes (self);
+
   for (children = self->children; children; children = children->next) {
     ChildInfo *child_info = children->data;
     GtkWidget *child = child_info->widget;
@@ -577,6 +635,9 @@ adw_carousel_measure (GtkWidget      *widget,
       *minimum = MAX (*minimum, child_min);
     if (natural)
       *natural = MAX (*natural, child_nat);
+
+    if (self->uniform_pages)
+      break;
   }
 }
 
@@ -591,40 +652,46 @@ adw_carousel_size_allocate (GtkWidget *widget,
   GList *children;
   double x, y, offset;
   gboolean is_rtl;
-  double snap_point;
+
+  ADW_LAYOUT_STATS_ALLOCATE (widget);
+
+  /* Before shifting, so that the position isn't clamped to the old range */
+  update_snap_points (self);
 
   if (self->position_shift != 0) {
     shift_position (self, self->position_shift);
     self->position_shift = 0;
   }
 
+  /* The children are only measured again after they have been resized, when
+   * only the position changes they are just moved. */
   size = 0;
   for (children = self->children; children; children = children->next) {
     ChildInfo *child_info = children->data;
     GtkWidget *child = child_info->widget;
-    int min, nat;
     int child_size;
 
     if (child_info->removing)
       continue;
 
     if (self->orientation == GTK_ORIENTATION_HORIZONTAL) {
-      gtk_widget_measure (child, self->orientation,
-                          height, &min, &nat, NULL, NULL);
+      measure_child (self, child_info, height);
       if (gtk_widget_get_hexpand (child))
-        child_size = MAX (min, width);
+        child_size = MAX (child_info->min_size, width);
       else
-        child_size = MAX (min, nat);
+        child_size = MAX (child_info->min_size, child_info->nat_size);
     } else {
-      gtk_widget_measure (child, self->orientation,
-                          width, &min, &nat, NULL, NULL);
+      measure_child (self, child_info, width);
       if (gtk_widget_get_vexpand (child))
-        child_size = MAX (min, height);
+        child_size = MAX (child_info->min_size, height);
       else
-        child_size = MAX (min, nat);
+        child_size = MAX (child_info->min_size, child_info->nat_size);
     }
 
     size = MAX (size, child_size);
+
+    if (self->uniform_pages && gtk_widget_get_visible (child))
+      break;
   }
 
   self->distance = size + self->spacing;
@@ -637,16 +704,6 @@ adw_carousel_size_allocate (GtkWidget *widget,
     child_height = size;
   }
 
-  snap_point = 0;
-
-  for (children = self->children; children; children = children->next) {
-    ChildInfo *child_info = children->data;
-
-    child_info->snap_point = snap_point + child_info->size - 1;
-
-    snap_point += child_info->size;
-  }
-
   if (!gtk_widget_get_realized (GTK_WIDGET (self)))
     return;
 
@@ -786,6 +843,10 @@ adw_carousel_get_property (GObject    *object,
     g_value_set_uint (value, adw_carousel_get_reveal_duration (self));
     break;
 
+  case PROP_UNIFORM_PAGES:
+    g_value_set_boolean (value, adw_carousel_get_uniform_pages (self));
+    break;
+
   case PROP_ORIENTATION:
     g_value_set_enum (value, self->orientation);
     break;
@@ -824,6 +885,10 @@ adw_carousel_set_property (GObject      *object,
     adw_carousel_set_reveal_duration (self, g_value_get_uint (value));
     break;
 
+  case PROP_UNIFORM_PAGES:
+    adw_carousel_set_uniform_pages (self, g_value_get_boolean (value));
+    break;
+
   case PROP_ALLOW_MOUSE_DRAG:
     adw_carousel_set_allow_mouse_drag (self, g_value_get_boolean (value));
     break;
@@ -841,6 +906,7 @@ adw_carousel_set_property (GObject      *object,
       GtkOrientation orientation = g_value_get_enum (value);
       if (orientation != self->orientation) {
         self->orientation = orientation;
+        invalidate_child_sizes (self);
         update_orientation (self);
         gtk_widget_queue_resize (GTK_WIDGET (self));
         g_object_notify (G_OBJECT (self), "orientation");
@@ -1014,6 +1080,23 @@ adw_carousel_class_init (AdwCarouselClass *klass)
                        0,
                        G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * AdwCarousel:uniform-pages: (attributes org.gtk.Property.get=adw_carousel_get_uniform_pages org.gtk.Property.set=adw_carousel_set_uniform_pages)
+   *
+   * Whether all pages have the same size.
+   *
+   * If `TRUE`, only the first page is measured and its size is used for all
+   * pages, instead of using the largest size among them.
+   *
+   * Since: 1.0
+   */
+  props[PROP_UNIFORM_PAGES] =
+    g_param_spec_boolean ("uniform-pages",
+                          "Uniform pages",
+                          "Whether all pages have the same size",
+                          FALSE,
+                          G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_override_property (object_class,
                                     PROP_ORIENTATION,
                                     "orientation");
@@ -1244,6 +1327,134 @@ adw_carousel_insert (AdwCarousel *self,
 
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_N_PAGES]);
 }
+
+/**
+ * adw_carousel_insert_pages:
+ * @self: a `AdwCarousel`
+ * @children: (array length=n_children): widgets to add
+ * @n_children: the length of @children
+ * @position: the position to insert @children at
+ * @animate: whether to animate the pages near the current page
+ *
+ * Inserts @children into @self at position @position.
+ *
+ * This is equivalent to calling [method@Adw.Carousel.insert] for each widget,
+ * but [property@Adw.Carousel:n-pages] is only notified once, and only the pages
+ * right next to the current page are revealed with an animation. The other
+ * pages are added at their full size right away. If @animate is `FALSE`, none
+ * of the pages are animated.
+ *
+ * If position is -1, or larger than the number of pages, @children will be
+ * appended to the end.
+ *
+ * Since: 1.0
+ */
+void
+adw_carousel_insert_pages (AdwCarousel       *self,
+                           GtkWidget * const *children,
+                           guint              n_children,
+                           int                position,
+                           gboolean           animate)
+{
+  ChildInfo *closest_child;
+  GList *prev_link = NULL, *first_link = NULL, *last_link = NULL, *l;
+  int index, closest_index;
+  double shift = 0;
+  guint i;
+
+  g_return_if_fail (ADW_IS_CAROUSEL (self));
+  g_return_if_fail (children != NULL || n_children == 0);
+  g_return_if_fail (position >= -1);
+
+  for (i = 0; i < n_children; i++)
+    g_return_if_fail (GTK_IS_WIDGET (children[i]));
+
+  if (n_children == 0)
+    return;
+
+  if (position >= 0)
+    prev_link = get_nth_link (self, position);
+
+  /* Matches update_shift_position_flag() */
+  closest_child = get_closest_child_at (self, self->position, FALSE, TRUE);
+
+  if (prev_link)
+    index = g_list_position (self->children, prev_link);
+  else
+    index = g_list_length (self->children);
+
+  if (closest_child) {
+    closest_index = g_list_index (self->children, closest_child);
+
+    if (closest_index >= index)
+      closest_index += n_children;
+  } else {
+    closest_index = index;
+  }
+
+  for (i = 0; i < n_children; i++) {
+    ChildInfo *info = g_new0 (ChildInfo, 1);
+
+    info->widget = children[i];
+
+    if (animate && ABS (index + (int) i - closest_index) <= 1) {
+      info->size = 0;
+      info->adding = TRUE;
+    } else {
+      info->size = 1;
+      info->shift_position = closest_child && closest_index >= index;
+
+      if (info->shift_position)
+        shift += 1;
+    }
+
+    first_link = g_list_prepend (first_link, info);
+  }
+
+  first_link = g_list_reverse (first_link);
+  last_link = g_list_last (first_link);
+
+  /* Splice the new links in one go instead of walking the list per page */
+  if (prev_link) {
+    first_link->prev = prev_link->prev;
+    last_link->next = prev_link;
+
+    if (prev_link->prev)
+      prev_link->prev->next = first_link;
+    else
+      self->children = first_link;
+
+    prev_link->prev = last_link;
+  } else {
+    self->children = g_list_concat (self->children, first_link);
+  }
+
+  for (l = first_link; l != last_link->next; l = l->next) {
+    ChildInfo *info = l->data;
+
+    gtk_widget_set_parent (info->widget, GTK_WIDGET (self));
+  }
+
+  /* The full size pages have to be accounted for right away, otherwise
+   * update_shift_position_flag() would see them at snap point 0 and could pick
+   * one of them as the closest page when revealing the animated pages */
+  update_snap_points (self);
+
+  if (shift != 0)
+    shift_position (self, shift);
+
+  gtk_widget_queue_allocate (GTK_WIDGET (self));
+
+  for (l = first_link; l != last_link->next; l = l->next) {
+    ChildInfo *info = l->data;
+
+    if (info->adding)
+      animate_child_resize (self, info, 1, self->reveal_duration);
+  }
+
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_N_PAGES]);
+}
+
 /**
  * adw_carousel_reorder:
  * @self: a `AdwCarousel`
@@ -1338,6 +1549,104 @@ adw_carousel_remove (AdwCarousel *self,
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_N_PAGES]);
 }
 
+/**
+ * adw_carousel_remove_pages:
+ * @self: a `AdwCarousel`
+ * @children: (array length=n_children): widgets to remove
+ * @n_children: the length of @children
+ * @animate: whether to animate the pages near the current page
+ *
+ * Removes @children from @self.
+ *
+ * This is equivalent to calling [method@Adw.Carousel.remove] for each widget,
+ * but [property@Adw.Carousel:n-pages] is only notified once, and only the pages
+ * right next to the current page are hidden with an animation. The other pages
+ * are removed right away. If @animate is `FALSE`, none of the pages are
+ * animated.
+ *
+ * Since: 1.0
+ */
+void
+adw_carousel_remove_pages (AdwCarousel       *self,
+                           GtkWidget * const *children,
+                           guint              n_children,
+                           gboolean           animate)
+{
+  g_autoptr (GHashTable) set = NULL;
+  g_autoptr (GPtrArray) animated = NULL;
+  ChildInfo *closest_child;
+  GList *l, *next;
+  int index, closest_index;
+  double shift = 0;
+  guint i;
+
+  g_return_if_fail (ADW_IS_CAROUSEL (self));
+  g_return_if_fail (children != NULL || n_children == 0);
+
+  for (i = 0; i < n_children; i++) {
+    g_return_if_fail (GTK_IS_WIDGET (children[i]));
+    g_return_if_fail (gtk_widget_get_parent (children[i]) == GTK_WIDGET (self));
+  }
+
+  if (n_children == 0)
+    return;
+
+  set = g_hash_table_new (NULL, NULL);
+  for (i = 0; i < n_children; i++)
+    g_hash_table_add (set, children[i]);
+
+  animated = g_ptr_array_new ();
+
+  /* Matches update_shift_position_flag() */
+  closest_child = get_closest_child_at (self, self->position, FALSE, TRUE);
+  closest_index = closest_child ? g_list_index (self->children, closest_child) : -1;
+
+  /* Indices are counted before any removal, like for the animated pages */
+  for (l = self->children, index = 0; l; l = next, index++) {
+    ChildInfo *info = l->data;
+
+    next = l->next;
+
+    if (info->removing || !g_hash_table_contains (set, info->widget))
+      continue;
+
+    /* Finish a pending reveal first, so that it doesn't free the child */
+    if (info->resize_animation)
+      adw_animation_stop (info->resize_animation);
+
+    info->removing = TRUE;
+
+    gtk_widget_unparent (info->widget);
+
+    info->widget = NULL;
+
+    if (gtk_widget_in_destruction (GTK_WIDGET (self)))
+      continue;
+
+    if ((animate && ABS (index - closest_index) <= 1) ||
+        info == self->animation_target_child) {
+      g_ptr_array_add (animated, info);
+      continue;
+    }
+
+    if (closest_index >= index)
+      shift -= info->size;
+
+    self->children = g_list_delete_link (self->children, l);
+    g_free (info);
+  }
+
+  self->position_shift += shift;
+
+  gtk_widget_queue_allocate (GTK_WIDGET (self));
+
+  for (i = 0; i < animated->len; i++)
+    animate_child_resize (self, g_ptr_array_index (animated, i), 0,
+                          self->reveal_duration);
+
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_N_PAGES]);
+}
+
 /**
  * adw_carousel_scroll_to:
  * @self: a `AdwCarousel`
@@ -1751,3 +2060,47 @@ adw_carousel_set_reveal_duration (AdwCarousel *self,
 
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_REVEAL_DURATION]);
 }
+
+/**
+ * adw_carousel_get_uniform_pages: (attributes org.gtk.Method.get_property=uniform-pages)
+ * @self: a `AdwCarousel`
+ *
+ * Gets whether all pages of @self have the same size.
+ *
+ * Returns: whether all pages have the same size
+ *
+ * Since: 1.0
+ */
+gboolean
+adw_carousel_get_uniform_pages (AdwCarousel *self)
+{
+  g_return_val_if_fail (ADW_IS_CAROUSEL (self), FALSE);
+
+  return self->uniform_pages;
+}
+
+/**
+ * adw_carousel_set_uniform_pages: (attributes org.gtk.Method.set_property=uniform-pages)
+ * @self: a `AdwCarousel`
+ * @uniform_pages: whether all pages have the same size
+ *
+ * Sets whether all pages of @self have the same size.
+ *
+ * Since: 1.0
+ */
+void
+adw_carousel_set_uniform_pages (AdwCarousel *self,
+                                gboolean     uniform_pages)
+{
+  g_return_if_fail (ADW_IS_CAROUSEL (self));
+
+  uniform_pages = !!uniform_pages;
+
+  if (self->uniform_pages == uniform_pages)
+    return;
+
+  self->uniform_pages = uniform_pages;
+  gtk_widget_queue_resize (GTK_WIDGET (self));
+
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_UNIFORM_PAGES]);
+}
@@ -34,6 +34,12 @@ ADW_AVAILABLE_IN_ALL
 void adw_carousel_insert  (AdwCarousel *self,
                            GtkWidget   *child,
                            int          position);
+ADW_AVAILABLE_IN_ALL
+void adw_carousel_insert_pages (AdwCarousel       *self,
+                                GtkWidget * const *children,
+                                guint              n_children,
+                                int                position,
+                                gboolean           animate);
 
 ADW_AVAILABLE_IN_ALL
 void adw_carousel_reorder (AdwCarousel *self,
@@ -43,6 +49,11 @@ void adw_carousel_reorder (AdwCarousel *self,
 ADW_AVAILABLE_IN_ALL
 void adw_carousel_remove (AdwCarousel *self,
                           GtkWidget   *child);
+ADW_AVAILABLE_IN_ALL
+void adw_carousel_remove_pages (AdwCarousel       *self,
+                                GtkWidget * const *children,
+                                guint              n_children,
+                                gboolean           animate);
 
 ADW_AVAILABLE_IN_ALL
 void adw_carousel_scroll_to      (AdwCarousel *self,
@@ -101,4 +112,10 @@ guint adw_carousel_get_reveal_duration (AdwCarousel *self);
 ADW_AVAILABLE_IN_ALL
 void  adw_carousel_set_reveal_duration (AdwCarousel *self,
                                         guint        reveal_duration);
+
+ADW_AVAILABLE_IN_ALL
+gboolean adw_carousel_get_uniform_pages (AdwCarousel *self);
+ADW_AVAILABLE_IN_ALL
+void     adw_carousel_set_uniform_pages (AdwCarousel *self,
+                                         gboolean     uniform_pages);
 G_END_DECLS
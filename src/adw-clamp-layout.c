@@ -10,6 +10,7 @@
 #include <math.h>
 
 #include "adw-animation-private.h"
+#include "adw-layout-stats-private.h"
 
 /**
  * AdwClampLayout:
@@ -28,6 +29,9 @@
  * size, .small when it's allocated the full size, .medium in-between, or none
  * if it hasn't been allocated yet.
  *
+ * If the widget using the layout is a [iface@Gtk.Scrollable], its scroll
+ * position is kept proportionally the same when the children are resized.
+ *
  * Since: 1.0
  */
 
@@ -37,11 +41,12 @@ enum {
   PROP_0,
   PROP_MAXIMUM_SIZE,
   PROP_TIGHTENING_THRESHOLD,
+  PROP_QUANTIZATION_STEP,
 
   /* Overridden properties */
   PROP_ORIENTATION,
 
-  LAST_PROP = PROP_TIGHTENING_THRESHOLD + 1,
+  LAST_PROP = PROP_QUANTIZATION_STEP + 1,
 };
 
 struct _AdwClampLayout
@@ -50,6 +55,7 @@ struct _AdwClampLayout
 
   int maximum_size;
   int tightening_threshold;
+  int quantization_step;
 
   GtkOrientation orientation;
 };
@@ -88,6 +94,9 @@ adw_clamp_layout_get_property (GObject    *object,
   case PROP_TIGHTENING_THRESHOLD:
     g_value_set_int (value, adw_clamp_layout_get_tightening_threshold (self));
     break;
+  case PROP_QUANTIZATION_STEP:
+    g_value_set_int (value, adw_clamp_layout_get_quantization_step (self));
+    break;
   case PROP_ORIENTATION:
     g_value_set_enum (value, self->orientation);
     break;
@@ -111,6 +120,9 @@ adw_clamp_layout_set_property (GObject      *object,
   case PROP_TIGHTENING_THRESHOLD:
     adw_clamp_layout_set_tightening_threshold (self, g_value_get_int (value));
     break;
+  case PROP_QUANTIZATION_STEP:
+    adw_clamp_layout_set_quantization_step (self, g_value_get_int (value));
+    break;
   case PROP_ORIENTATION:
     set_orientation (self, g_value_get_enum (value));
     break;
@@ -129,6 +141,7 @@ get_child_size (AdwClampLayout *self,
                 int            *upper_threshold)
 {
   int min = 0, max = 0, lower = 0, upper = 0;
+  int size;
   double amplitude, progress;
 
   if (gtk_widget_get_visible (child))
@@ -159,7 +172,62 @@ get_child_size (AdwClampLayout *self,
 
   progress = (double) (for_size - lower) / (double) (upper - lower);
 
-  return adw_ease_out_cubic (progress) * amplitude + lower;
+  size = adw_ease_out_cubic (progress) * amplitude + lower;
+
+  /* Only change the size in steps while clamping, so that resizing doesn't
+   * relayout the children on every pixel */
+  if (self->quantization_step > 1)
+    size -= (size - lower) % self->quantization_step;
+
+  return size;
+}
+
+static GtkAdjustment *
+get_anchor_adjustment (AdwClampLayout *self,
+                       GtkWidget      *widget,
+                       GtkWidget      *child)
+{
+  if (!GTK_IS_SCROLLABLE (widget))
+    return NULL;
+
+  /* List widgets already keep their own anchor across relayouts */
+  if (GTK_IS_LIST_VIEW (child) ||
+      GTK_IS_GRID_VIEW (child) ||
+      GTK_IS_COLUMN_VIEW (child))
+    return NULL;
+
+  /* Clamping the width reflows the content vertically, and vice versa */
+  if (self->orientation == GTK_ORIENTATION_HORIZONTAL)
+    return gtk_scrollable_get_vadjustment (GTK_SCROLLABLE (widget));
+  else
+    return gtk_scrollable_get_hadjustment (GTK_SCROLLABLE (widget));
+}
+
+static double
+get_scroll_fraction (GtkAdjustment *adjustment)
+{
+  double lower = gtk_adjustment_get_lower (adjustment);
+  double range = gtk_adjustment_get_upper (adjustment) - lower -
+                 gtk_adjustment_get_page_size (adjustment);
+
+  if (range <= 0)
+    return 0;
+
+  return (gtk_adjustment_get_value (adjustment) - lower) / range;
+}
+
+static void
+set_scroll_fraction (GtkAdjustment *adjustment,
+                     double         fraction)
+{
+  double lower = gtk_adjustment_get_lower (adjustment);
+  double range = gtk_adjustment_get_upper (adjustment) - lower -
+                 gtk_adjustment_get_page_size (adjustment);
+
+  if (range <= 0)
+    return;
+
+  gtk_adjustment_set_value (adjustment, lower + fraction * range);
 }
 
 static GtkSizeRequestMode
@@ -186,6 +254,8 @@ adw_clamp_layout_measure (GtkLayoutManager *manager,
   AdwClampLayout *self = ADW_CLAMP_LAYOUT (manager);
   GtkWidget *child;
 
+  ADW_LAYOUT_STATS_MEASURE (widget);
+
   for (child = gtk_widget_get_first_child (widget);
        child != NULL;
        child = gtk_widget_get_next_sibling (child)) {
@@ -226,12 +296,16 @@ adw_clamp_layout_allocate (GtkLayoutManager *manager,
   AdwClampLayout *self = ADW_CLAMP_LAYOUT (manager);
   GtkWidget *child;
 
+  ADW_LAYOUT_STATS_ALLOCATE (widget);
+
   for (child = gtk_widget_get_first_child (widget);
        child != NULL;
        child = gtk_widget_get_next_sibling (child)) {
     GtkAllocation child_allocation;
+    GtkAdjustment *anchor_adjustment;
     int child_maximum = 0, lower_threshold = 0;
-    int child_clamped_size;
+    int child_clamped_size, child_old_size;
+    double scroll_fraction = 0;
 
     if (!gtk_widget_should_layout (child)) {
       gtk_widget_remove_css_class (child, "small");
@@ -248,6 +322,7 @@ adw_clamp_layout_allocate (GtkLayoutManager *manager,
       child_allocation.height = height;
 
       child_clamped_size = child_allocation.width;
+      child_old_size = gtk_widget_get_width (child);
     }
     else {
       child_allocation.width = width;
@@ -256,8 +331,17 @@ adw_clamp_layout_allocate (GtkLayoutManager *manager,
                                                 &lower_threshold, NULL);
 
       child_clamped_size = child_allocation.height;
+      child_old_size = gtk_widget_get_height (child);
     }
 
+    /* Keep the scroll position across the reflow caused by resizing */
+    anchor_adjustment = NULL;
+    if (child_old_size > 0 && child_old_size != child_clamped_size)
+      anchor_adjustment = get_anchor_adjustment (self, widget, child);
+
+    if (anchor_adjustment)
+      scroll_fraction = get_scroll_fraction (anchor_adjustment);
+
     if (child_clamped_size >= child_maximum) {
       gtk_widget_remove_css_class (child, "small");
       gtk_widget_remove_css_class (child, "medium");
@@ -282,6 +366,9 @@ adw_clamp_layout_allocate (GtkLayoutManager *manager,
     }
 
     gtk_widget_size_allocate (child, &child_allocation, baseline);
+
+    if (anchor_adjustment)
+      set_scroll_fraction (anchor_adjustment, scroll_fraction);
   }
 }
 
@@ -344,6 +431,27 @@ adw_clamp_layout_class_init (AdwClampLayoutClass *klass)
                         0, G_MAXINT, 400,
                         G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * AdwClampLayout:quantization-step: (attributes org.gtk.Property.get=adw_clamp_layout_get_quantization_step org.gtk.Property.set=adw_clamp_layout_set_quantization_step)
+   *
+   * The step by which the clamped size of the children changes.
+   *
+   * Above the tightening threshold, the size allocated to the children is
+   * rounded down to a multiple of this step, so that resizing the layout only
+   * resizes the children once the available size changed enough. This is
+   * useful for children that are expensive to lay out, such as long lists.
+   *
+   * If it's 0 or 1, the size changes on every pixel.
+   *
+   * Since: 1.0
+   */
+  props[PROP_QUANTIZATION_STEP] =
+      g_param_spec_int ("quantization-step",
+                        "Quantization step",
+                        "The step by which the clamped size of the children changes",
+                        0, G_MAXINT, 0,
+                        G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (object_class, LAST_PROP, props);
 }
 
@@ -454,3 +562,47 @@ adw_clamp_layout_set_tightening_threshold (AdwClampLayout *self,
 
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_TIGHTENING_THRESHOLD]);
 }
+
+/**
+ * adw_clamp_layout_get_quantization_step: (attributes org.gtk.Method.get_property=quantization-step)
+ * @self: a `AdwClampLayout`
+ *
+ * Gets the step by which the clamped size of the children changes.
+ *
+ * Returns: the step by which the clamped size of the children changes
+ *
+ * Since: 1.0
+ */
+int
+adw_clamp_layout_get_quantization_step (AdwClampLayout *self)
+{
+  g_return_val_if_fail (ADW_IS_CLAMP_LAYOUT (self), 0);
+
+  return self->quantization_step;
+}
+
+/**
+ * adw_clamp_layout_set_quantization_step: (attributes org.gtk.Method.set_property=quantization-step)
+ * @self: a `AdwClampLayout`
+ * @quantization_step: the quantization step
+ *
+ * Sets the step by which the clamped size of the children changes.
+ *
+ * Since: 1.0
+ */
+void
+adw_clamp_layout_set_quantization_step (AdwClampLayout *self,
+                                        int             quantization_step)
+{
+  g_return_if_fail (ADW_IS_CLAMP_LAYOUT (self));
+  g_return_if_fail (quantization_step >= 0);
+
+  if (self->quantization_step == quantization_step)
+    return;
+
+  self->quantization_step = quantization_step;
+
+  gtk_layout_manager_layout_changed (GTK_LAYOUT_MANAGER (self));
+
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_QUANTIZATION_STEP]);
+}
@@ -36,4 +36,10 @@ ADW_AVAILABLE_IN_ALL
 void adw_clamp_layout_set_tightening_threshold (AdwClampLayout *self,
                                                 int             tightening_threshold);
 
+ADW_AVAILABLE_IN_ALL
+int  adw_clamp_layout_get_quantization_step (AdwClampLayout *self);
+ADW_AVAILABLE_IN_ALL
+void adw_clamp_layout_set_quantization_step (AdwClampLayout *self,
+                                             int             quantization_step);
+
 G_END_DECLS
@@ -28,6 +28,7 @@ enum {
   PROP_CHILD,
   PROP_MAXIMUM_SIZE,
   PROP_TIGHTENING_THRESHOLD,
+  PROP_QUANTIZATION_STEP,
 
   /* Overridden properties */
   PROP_ORIENTATION,
@@ -36,7 +37,7 @@ enum {
   PROP_HSCROLL_POLICY,
   PROP_VSCROLL_POLICY,
 
-  LAST_PROP = PROP_TIGHTENING_THRESHOLD + 1,
+  LAST_PROP = PROP_QUANTIZATION_STEP + 1,
 };
 
 struct _AdwClampScrollable
@@ -151,6 +152,9 @@ adw_clamp_scrollable_get_property (GObject    *object,
   case PROP_TIGHTENING_THRESHOLD:
     g_value_set_int (value, adw_clamp_scrollable_get_tightening_threshold (self));
     break;
+  case PROP_QUANTIZATION_STEP:
+    g_value_set_int (value, adw_clamp_scrollable_get_quantization_step (self));
+    break;
   case PROP_ORIENTATION:
     g_value_set_enum (value, self->orientation);
     break;
@@ -189,6 +193,9 @@ adw_clamp_scrollable_set_property (GObject      *object,
   case PROP_TIGHTENING_THRESHOLD:
     adw_clamp_scrollable_set_tightening_threshold (self, g_value_get_int (value));
     break;
+  case PROP_QUANTIZATION_STEP:
+    adw_clamp_scrollable_set_quantization_step (self, g_value_get_int (value));
+    break;
   case PROP_ORIENTATION:
     set_orientation (self, g_value_get_enum (value));
     break;
@@ -306,6 +313,27 @@ adw_clamp_scrollable_class_init (AdwClampScrollableClass *klass)
                         0, G_MAXINT, 400,
                         G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * AdwClampScrollable:quantization-step: (attributes org.gtk.Property.get=adw_clamp_scrollable_get_quantization_step org.gtk.Property.set=adw_clamp_scrollable_set_quantization_step)
+   *
+   * The step by which the clamped size of the child changes.
+   *
+   * Above the tightening threshold, the size allocated to the child is rounded
+   * down to a multiple of this step, so that resizing the clamp only resizes
+   * the child once the available size changed enough. This is useful for
+   * children that are expensive to lay out, such as long lists.
+   *
+   * If it's 0 or 1, the size changes on every pixel.
+   *
+   * Since: 1.0
+   */
+  props[PROP_QUANTIZATION_STEP] =
+      g_param_spec_int ("quantization-step",
+                        "Quantization step",
+                        "The step by which the clamped size of the child changes",
+                        0, G_MAXINT, 0,
+                        G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (object_class, LAST_PROP, props);
 
   gtk_widget_class_set_layout_manager_type (widget_class, ADW_TYPE_CLAMP_LAYOUT);
@@ -521,3 +549,53 @@ adw_clamp_scrollable_set_tightening_threshold (AdwClampScrollable *self,
 
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_TIGHTENING_THRESHOLD]);
 }
+
+/**
+ * adw_clamp_scrollable_get_quantization_step: (attributes org.gtk.Method.get_property=quantization-step)
+ * @self: a `AdwClampScrollable`
+ *
+ * Gets the step by which the clamped size of the child changes.
+ *
+ * Returns: the step by which the clamped size of the child changes
+ *
+ * Since: 1.0
+ */
+int
+adw_clamp_scrollable_get_quantization_step (AdwClampScrollable *self)
+{
+  AdwClampLayout *layout;
+
+  g_return_val_if_fail (ADW_IS_CLAMP_SCROLLABLE (self), 0);
+
+  layout = ADW_CLAMP_LAYOUT (gtk_widget_get_layout_manager (GTK_WIDGET (self)));
+
+  return adw_clamp_layout_get_quantization_step (layout);
+}
+
+/**
+ * adw_clamp_scrollable_set_quantization_step: (attributes org.gtk.Method.set_property=quantization-step)
+ * @self: a `AdwClampScrollable`
+ * @quantization_step: the quantization step
+ *
+ * Sets the step by which the clamped size of the child changes.
+ *
+ * Since: 1.0
+ */
+void
+adw_clamp_scrollable_set_quantization_step (AdwClampScrollable *self,
+                                            int                 quantization_step)
+{
+  AdwClampLayout *layout;
+
+  g_return_if_fail (ADW_IS_CLAMP_SCROLLABLE (self));
+  g_return_if_fail (quantization_step >= 0);
+
+  layout = ADW_CLAMP_LAYOUT (gtk_widget_get_layout_manager (GTK_WIDGET (self)));
+
+  if (adw_clamp_layout_get_quantization_step (layout) == quantization_step)
+    return;
+
+  adw_clamp_layout_set_quantization_step (layout, quantization_step);
+
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_QUANTIZATION_STEP]);
+}
@@ -42,4 +42,10 @@ ADW_AVAILABLE_IN_ALL
 void adw_clamp_scrollable_set_tightening_threshold (AdwClampScrollable *self,
                                                     int                 tightening_threshold);
 
+ADW_AVAILABLE_IN_ALL
+int  adw_clamp_scrollable_get_quantization_step (AdwClampScrollable *self);
+ADW_AVAILABLE_IN_ALL
+void adw_clamp_scrollable_set_quantization_step (AdwClampScrollable *self,
+                                                 int                 quantization_step);
+
 G_END_DECLS
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#pragma once
+
+#if !defined(_ADWAITA_INSIDE) && !defined(ADWAITA_COMPILATION)
+#error "Only <adwaita.h> can be included directly."
+#endif
+
+#include <gtk/gtk.h>
+
+G_BEGIN_DECLS
+
+#define ADW_FADE_WIDTH 18
+
+/* Mask nodes are only available since GTK 4.10, older versions draw the
+ * faded content into textures instead */
+#define ADW_HAS_MASK_NODES GTK_CHECK_VERSION (4, 10, 0)
+
+typedef struct {
+  /* The gradient mask with mask nodes, the drawn texture otherwise */
+  GskRenderNode *result;
+  GskRenderNode *node;
+  GskRenderNode *node_mask;
+  graphene_rect_t bounds;
+  int scale_factor;
+  float offset_left;
+  float offset_right;
+  float strength_left;
+  float strength_right;
+} AdwFadeCache;
+
+gboolean adw_fade_shaders_disabled (void);
+
+void adw_fade_append      (GtkSnapshot           *snapshot,
+                           AdwFadeCache          *cache,
+                           int                    scale_factor,
+                           const graphene_rect_t *bounds,
+                           GskRenderNode         *node,
+                           float                  offset_left,
+                           float                  offset_right,
+                           float                  strength_left,
+                           float                  strength_right);
+void adw_fade_cache_clear (AdwFadeCache          *cache);
+
+#if !ADW_HAS_MASK_NODES
+void adw_mask_append_cut_out (GtkSnapshot   *snapshot,
+                              AdwFadeCache  *cache,
+                              int            scale_factor,
+                              GskRenderNode *node,
+                              GskRenderNode *mask);
+#endif
+
+G_END_DECLS
@@ -0,0 +1,320 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "config.h"
+
+#include "adw-fade-private.h"
+
+#include <math.h>
+
+/* Edge fades matching glsl/fade.glsl and masks matching glsl/mask.glsl, for
+ * when the shaders can't be used, e.g. with the cairo renderer.
+ *
+ * With mask nodes, fades mask the content with a horizontal linear gradient,
+ * which is kept between frames as long as the fade doesn't change.
+ *
+ * Without them, the faded or masked content is drawn with cairo into a texture
+ * instead. The texture is kept between frames as long as the content nodes,
+ * which GTK keeps for widgets that haven't been redrawn, and the parameters
+ * stay the same, so that only changed content is drawn again.
+ */
+
+gboolean
+adw_fade_shaders_disabled (void)
+{
+  static int disabled = -1;
+
+  /* Allows comparing both code paths with the same renderer */
+  if (disabled < 0)
+    disabled = !!g_getenv ("ADW_DEBUG_NO_GL_SHADERS");
+
+  return disabled;
+}
+
+static void
+get_color_stops (float        width,
+                 float        offset_left,
+                 float        offset_right,
+                 float        strength_left,
+                 float        strength_right,
+                 GskColorStop stops[4])
+{
+  stops[0].offset = CLAMP (offset_left / width, 0, 1);
+  stops[0].color = (GdkRGBA) { 0, 0, 0, 1 - strength_left };
+
+  stops[1].offset = CLAMP ((offset_left + ADW_FADE_WIDTH) / width, stops[0].offset, 1);
+  stops[1].color = (GdkRGBA) { 0, 0, 0, 1 };
+
+  /* If the two fades overlap, the right one starts where the left one ends */
+  stops[2].offset = CLAMP ((width - offset_right - ADW_FADE_WIDTH) / width, stops[1].offset, 1);
+  stops[2].color = (GdkRGBA) { 0, 0, 0, 1 };
+
+  stops[3].offset = CLAMP ((width - offset_right) / width, stops[2].offset, 1);
+  stops[3].color = (GdkRGBA) { 0, 0, 0, 1 - strength_right };
+}
+
+#if ADW_HAS_MASK_NODES
+static GskRenderNode *
+create_mask (const graphene_rect_t *bounds,
+             float                  offset_left,
+             float                  offset_right,
+             float                  strength_left,
+             float                  strength_right)
+{
+  float width = bounds->size.width;
+  GskColorStop stops[4];
+
+  if (width <= 0)
+    return NULL;
+
+  get_color_stops (width, offset_left, offset_right,
+                   strength_left, strength_right, stops);
+
+  return gsk_linear_gradient_node_new (bounds,
+                                       &GRAPHENE_POINT_INIT (bounds->origin.x,
+                                                             bounds->origin.y),
+                                       &GRAPHENE_POINT_INIT (bounds->origin.x + width,
+                                                             bounds->origin.y),
+                                       stops,
+                                       G_N_ELEMENTS (stops));
+}
+#else
+/* Widgets that haven't been redrawn keep their node, but their parents wrap it
+ * into a new transform node every time they are snapshotted */
+static gboolean
+nodes_equal (GskRenderNode *a,
+             GskRenderNode *b)
+{
+  if (a == b)
+    return TRUE;
+
+  if (!a || !b)
+    return FALSE;
+
+  if (gsk_render_node_get_node_type (a) != GSK_TRANSFORM_NODE ||
+      gsk_render_node_get_node_type (b) != GSK_TRANSFORM_NODE)
+    return FALSE;
+
+  return gsk_transform_equal (gsk_transform_node_get_transform (a),
+                              gsk_transform_node_get_transform (b)) &&
+         nodes_equal (gsk_transform_node_get_child (a),
+                      gsk_transform_node_get_child (b));
+}
+
+static cairo_t *
+begin_texture (const graphene_rect_t *bounds,
+               int                    scale_factor)
+{
+  cairo_surface_t *surface;
+  cairo_t *cr;
+
+  surface = cairo_image_surface_create (CAIRO_FORMAT_ARGB32,
+                                        ceilf (bounds->size.width * scale_factor),
+                                        ceilf (bounds->size.height * scale_factor));
+  cairo_surface_set_device_scale (surface, scale_factor, scale_factor);
+
+  cr = cairo_create (surface);
+  cairo_translate (cr, -bounds->origin.x, -bounds->origin.y);
+
+  cairo_surface_destroy (surface);
+
+  return cr;
+}
+
+static GskRenderNode *
+end_texture (cairo_t               *cr,
+             const graphene_rect_t *bounds)
+{
+  cairo_surface_t *surface = cairo_surface_reference (cairo_get_target (cr));
+  g_autoptr (GBytes) bytes = NULL;
+  g_autoptr (GdkTexture) texture = NULL;
+  int height, stride;
+
+  cairo_destroy (cr);
+  cairo_surface_flush (surface);
+
+  height = cairo_image_surface_get_height (surface);
+  stride = cairo_image_surface_get_stride (surface);
+
+  /* The bytes keep the surface alive */
+  bytes = g_bytes_new_with_free_func (cairo_image_surface_get_data (surface),
+                                      height * stride,
+                                      (GDestroyNotify) cairo_surface_destroy,
+                                      surface);
+
+  texture = gdk_memory_texture_new (cairo_image_surface_get_width (surface),
+                                    height,
+                                    GDK_MEMORY_DEFAULT,
+                                    bytes,
+                                    stride);
+
+  return gsk_texture_node_new (texture, bounds);
+}
+
+static gboolean
+cache_is_valid (AdwFadeCache          *cache,
+                const graphene_rect_t *bounds,
+                int                    scale_factor,
+                GskRenderNode         *node,
+                GskRenderNode         *mask)
+{
+  return cache->result &&
+         cache->scale_factor == scale_factor &&
+         graphene_rect_equal (&cache->bounds, bounds) &&
+         nodes_equal (cache->node, node) &&
+         nodes_equal (cache->node_mask, mask);
+}
+
+static void
+cache_store (AdwFadeCache          *cache,
+             const graphene_rect_t *bounds,
+             int                    scale_factor,
+             GskRenderNode         *node,
+             GskRenderNode         *mask,
+             GskRenderNode         *result)
+{
+  adw_fade_cache_clear (cache);
+
+  cache->bounds = *bounds;
+  cache->scale_factor = scale_factor;
+  cache->node = gsk_render_node_ref (node);
+  cache->node_mask = mask ? gsk_render_node_ref (mask) : NULL;
+  cache->result = result;
+}
+#endif
+
+void
+adw_fade_append (GtkSnapshot           *snapshot,
+                 AdwFadeCache          *cache,
+                 int                    scale_factor,
+                 const graphene_rect_t *bounds,
+                 GskRenderNode         *node,
+                 float                  offset_left,
+                 float                  offset_right,
+                 float                  strength_left,
+                 float                  strength_right)
+{
+#if !ADW_HAS_MASK_NODES
+  graphene_rect_t texture_bounds;
+  cairo_t *cr;
+  cairo_pattern_t *pattern;
+  GskColorStop stops[4];
+  guint i;
+#endif
+
+  /* Nothing would be visible, and the gradient would divide by 0 */
+  if (!node || bounds->size.width <= 0 || bounds->size.height <= 0)
+    return;
+
+  if (cache->result &&
+      (cache->offset_left != offset_left ||
+       cache->offset_right != offset_right ||
+       cache->strength_left != strength_left ||
+       cache->strength_right != strength_right))
+    adw_fade_cache_clear (cache);
+
+#if ADW_HAS_MASK_NODES
+  if (!cache->result || !graphene_rect_equal (&cache->bounds, bounds)) {
+    adw_fade_cache_clear (cache);
+
+    cache->result = create_mask (bounds, offset_left, offset_right,
+                                 strength_left, strength_right);
+    cache->bounds = *bounds;
+  }
+
+  gtk_snapshot_push_mask (snapshot, GSK_MASK_MODE_ALPHA);
+  gtk_snapshot_append_node (snapshot, cache->result);
+  gtk_snapshot_pop (snapshot);
+
+  gtk_snapshot_append_node (snapshot, node);
+  gtk_snapshot_pop (snapshot);
+#else
+  graphene_rect_round_extents (bounds, &texture_bounds);
+
+  if (!cache_is_valid (cache, &texture_bounds, scale_factor, node, NULL)) {
+    cr = begin_texture (&texture_bounds, scale_factor);
+
+    gsk_render_node_draw (node, cr);
+
+    get_color_stops (bounds->size.width, offset_left, offset_right,
+                     strength_left, strength_right, stops);
+
+    pattern = cairo_pattern_create_linear (bounds->origin.x, 0,
+                                           bounds->origin.x + bounds->size.width, 0);
+
+    for (i = 0; i < G_N_ELEMENTS (stops); i++)
+      cairo_pattern_add_color_stop_rgba (pattern, stops[i].offset,
+                                         0, 0, 0, stops[i].color.alpha);
+
+    cairo_set_operator (cr, CAIRO_OPERATOR_DEST_IN);
+    cairo_set_source (cr, pattern);
+    cairo_paint (cr);
+
+    cairo_pattern_destroy (pattern);
+
+    cache_store (cache, &texture_bounds, scale_factor, node, NULL,
+                 end_texture (cr, &texture_bounds));
+  }
+
+  gtk_snapshot_append_node (snapshot, cache->result);
+#endif
+
+  cache->offset_left = offset_left;
+  cache->offset_right = offset_right;
+  cache->strength_left = strength_left;
+  cache->strength_right = strength_right;
+}
+
+#if !ADW_HAS_MASK_NODES
+/* Same as glsl/mask.glsl: @mask cuts itself out of @node */
+void
+adw_mask_append_cut_out (GtkSnapshot   *snapshot,
+                         AdwFadeCache  *cache,
+                         int            scale_factor,
+                         GskRenderNode *node,
+                         GskRenderNode *mask)
+{
+  graphene_rect_t bounds;
+  cairo_t *cr;
+
+  if (!node)
+    return;
+
+  gsk_render_node_get_bounds (node, &bounds);
+  graphene_rect_round_extents (&bounds, &bounds);
+
+  if (bounds.size.width <= 0 || bounds.size.height <= 0)
+    return;
+
+  if (!cache_is_valid (cache, &bounds, scale_factor, node, mask)) {
+    cr = begin_texture (&bounds, scale_factor);
+
+    gsk_render_node_draw (node, cr);
+
+    if (mask) {
+      cairo_push_group (cr);
+      gsk_render_node_draw (mask, cr);
+      cairo_pop_group_to_source (cr);
+
+      cairo_set_operator (cr, CAIRO_OPERATOR_DEST_OUT);
+      cairo_paint (cr);
+    }
+
+    cache_store (cache, &bounds, scale_factor, node, mask,
+                 end_texture (cr, &bounds));
+  }
+
+  gtk_snapshot_append_node (snapshot, cache->result);
+}
+#endif
+
+void
+adw_fade_cache_clear (AdwFadeCache *cache)
+{
+  g_clear_pointer (&cache->result, gsk_render_node_unref);
+  g_clear_pointer (&cache->node, gsk_render_node_unref);
+  g_clear_pointer (&cache->node_mask, gsk_render_node_unref);
+}
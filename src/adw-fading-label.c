@@ -11,6 +11,7 @@
 
 #include <glib/gi18n-lib.h>
 #include "adw-bidi-private.h"
+#include "adw-fade-private.h"
 
 #define FADE_WIDTH 18
 
@@ -23,6 +24,8 @@ struct _AdwFadingLabel
 
   GskGLShader *shader;
   gboolean shader_compiled;
+
+  AdwFadeCache fade_cache;
 };
 
 G_DEFINE_TYPE (AdwFadingLabel, adw_fading_label, GTK_TYPE_WIDGET)
@@ -61,7 +64,7 @@ ensure_shader (AdwFadingLabel *self)
   GskRenderer *renderer;
   g_autoptr (GError) error = NULL;
 
-  if (self->shader)
+  if (self->shader || adw_fade_shaders_disabled ())
     return;
 
   self->shader = gsk_gl_shader_new_from_resource ("/org/gnome/Adwaita/glsl/fade.glsl");
@@ -151,23 +154,27 @@ adw_fading_label_snapshot (GtkWidget   *widget,
 
   ensure_shader (self);
 
-  if (self->shader_compiled) {
-    gtk_snapshot_push_gl_shader (snapshot, self->shader, &bounds,
-                                 gsk_gl_shader_format_args (self->shader,
-                                                            "offsetLeft", 0.0f,
-                                                            "offsetRight", 0.0f,
-                                                            "strengthLeft", align > 0 ? 1.0f : 0.0f,
-                                                            "strengthRight", align < 1 ? 1.0f : 0.0f,
-                                                            NULL));
-  } else {
-    gtk_snapshot_push_clip (snapshot, &bounds);
+  if (!self->shader_compiled) {
+    adw_fade_append (snapshot, &self->fade_cache,
+                     gtk_widget_get_scale_factor (widget), &bounds, node,
+                     0.0f, 0.0f,
+                     align > 0 ? 1.0f : 0.0f,
+                     align < 1 ? 1.0f : 0.0f);
+
+    return;
   }
 
-  gtk_snapshot_append_node (snapshot, node);
+  gtk_snapshot_push_gl_shader (snapshot, self->shader, &bounds,
+                               gsk_gl_shader_format_args (self->shader,
+                                                          "offsetLeft", 0.0f,
+                                                          "offsetRight", 0.0f,
+                                                          "strengthLeft", align > 0 ? 1.0f : 0.0f,
+                                                          "strengthRight", align < 1 ? 1.0f : 0.0f,
+                                                          NULL));
 
-  if (self->shader_compiled)
-    gtk_snapshot_gl_shader_pop_texture (snapshot);
+  gtk_snapshot_append_node (snapshot, node);
 
+  gtk_snapshot_gl_shader_pop_texture (snapshot);
   gtk_snapshot_pop (snapshot);
 }
 
@@ -221,6 +228,7 @@ adw_fading_label_dispose (GObject *object)
   AdwFadingLabel *self = ADW_FADING_LABEL (object);
 
   g_clear_object (&self->shader);
+  adw_fade_cache_clear (&self->fade_cache);
   g_clear_pointer (&self->label, gtk_widget_unparent);
 
   G_OBJECT_CLASS (adw_fading_label_parent_class)->dispose (object);
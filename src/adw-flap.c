@@ -12,6 +12,7 @@
 
 #include "adw-animation-private.h"
 #include "adw-gizmo-private.h"
+#include "adw-layout-stats-private.h"
 #include "adw-shadow-helper-private.h"
 #include "adw-swipeable.h"
 #include "adw-swipe-tracker-private.h"
@@ -109,6 +110,12 @@ typedef struct {
   GtkAllocation allocation;
 } ChildInfo;
 
+typedef struct {
+  int flap;
+  int content;
+  int separator;
+} FlapSizes;
+
 struct _AdwFlap
 {
   GtkWidget parent_instance;
@@ -146,6 +153,13 @@ struct _AdwFlap
 
   gboolean modal;
   GtkEventController *shortcut_controller;
+
+  gboolean stable_allocation;
+  gboolean sizes_cached;
+  int cached_width;
+  int cached_height;
+  FlapSizes cached_sizes[2][2]; /* [folded][revealed] */
+  FlapSizes stable_sizes;
 };
 
 static void adw_flap_buildable_init (GtkBuildableIface *iface);
@@ -175,6 +189,7 @@ enum {
   PROP_MODAL,
   PROP_SWIPE_TO_OPEN,
   PROP_SWIPE_TO_CLOSE,
+  PROP_STABLE_ALLOCATION,
 
   /* Overridden properties */
   PROP_ORIENTATION,
@@ -218,6 +233,13 @@ set_orientation (AdwFlap        *self,
   g_object_notify (G_OBJECT (self), "orientation");
 }
 
+static inline gboolean
+use_stable_allocation (AdwFlap *self)
+{
+  return self->stable_allocation &&
+         (self->reveal_animation || self->fold_animation || self->swipe_active);
+}
+
 static void
 update_child_visibility (AdwFlap *self)
 {
@@ -284,6 +306,11 @@ static void
 fold_animation_done_cb (AdwFlap *self)
 {
   g_clear_pointer (&self->fold_animation, adw_animation_unref);
+
+  /* Children may still have their transition sizes, allocate them at the
+   * final size now that the animation is over */
+  if (self->stable_allocation)
+    gtk_widget_queue_allocate (GTK_WIDGET (self));
 }
 
 static void
@@ -292,6 +319,8 @@ animate_fold (AdwFlap *self)
   if (self->fold_animation)
     adw_animation_stop (self->fold_animation);
 
+  self->sizes_cached = FALSE;
+
   self->fold_animation =
     adw_animation_new (GTK_WIDGET (self),
                        self->fold_progress,
@@ -335,6 +364,8 @@ animate_reveal (AdwFlap *self,
   if (self->reveal_animation)
     adw_animation_stop (self->reveal_animation);
 
+  self->sizes_cached = FALSE;
+
   self->reveal_animation =
     adw_animation_new (GTK_WIDGET (self),
                        self->reveal_progress,
@@ -426,6 +457,7 @@ update_swipe_cb (AdwSwipeTracker *tracker,
     if (self->reveal_animation)
       adw_animation_stop (self->reveal_animation);
 
+    self->sizes_cached = FALSE;
     self->swipe_active = TRUE;
   }
 
@@ -683,6 +715,79 @@ compute_sizes (AdwFlap  *self,
     *content_size = total;
 }
 
+static void
+cache_sizes (AdwFlap *self,
+             int      width,
+             int      height)
+{
+  int folded, revealed;
+
+  self->stable_sizes.flap = 0;
+  self->stable_sizes.content = 0;
+
+  for (folded = 0; folded < 2; folded++) {
+    for (revealed = 0; revealed < 2; revealed++) {
+      FlapSizes *sizes = &self->cached_sizes[folded][revealed];
+
+      sizes->flap = 0;
+      sizes->content = 0;
+      sizes->separator = 0;
+
+      compute_sizes (self, width, height, folded, revealed,
+                     &sizes->flap, &sizes->content, &sizes->separator);
+
+      self->stable_sizes.flap = MAX (self->stable_sizes.flap, sizes->flap);
+      self->stable_sizes.content = MAX (self->stable_sizes.content, sizes->content);
+    }
+  }
+
+  self->cached_width = width;
+  self->cached_height = height;
+  self->sizes_cached = TRUE;
+}
+
+static inline gboolean
+sizes_cache_is_valid (AdwFlap *self,
+                      int      width,
+                      int      height)
+{
+  return self->sizes_cached &&
+         self->cached_width == width &&
+         self->cached_height == height;
+}
+
+/* When keeping allocations stable, measure the children once for every
+ * folded/revealed combination and reuse the results for every frame until
+ * the transition is over, or until the flap is measured again */
+static void
+get_sizes (AdwFlap  *self,
+           int       width,
+           int       height,
+           gboolean  folded,
+           gboolean  revealed,
+           int      *flap_size,
+           int      *content_size,
+           int      *separator_size)
+{
+  FlapSizes *sizes;
+
+  if (!use_stable_allocation (self)) {
+    compute_sizes (self, width, height, folded, revealed,
+                   flap_size, content_size, separator_size);
+
+    return;
+  }
+
+  if (!sizes_cache_is_valid (self, width, height))
+    cache_sizes (self, width, height);
+
+  sizes = &self->cached_sizes[folded ? 1 : 0][revealed ? 1 : 0];
+
+  *flap_size = sizes->flap;
+  *content_size = sizes->content;
+  *separator_size = sizes->separator;
+}
+
 static inline void
 interpolate_reveal (AdwFlap  *self,
                     int       width,
@@ -693,15 +798,15 @@ interpolate_reveal (AdwFlap  *self,
                     int      *separator_size)
 {
   if (self->reveal_progress <= 0) {
-    compute_sizes (self, width, height, folded, FALSE, flap_size, content_size, separator_size);
+    get_sizes (self, width, height, folded, FALSE, flap_size, content_size, separator_size);
   } else if (self->reveal_progress >= 1) {
-    compute_sizes (self, width, height, folded, TRUE, flap_size, content_size, separator_size);
+    get_sizes (self, width, height, folded, TRUE, flap_size, content_size, separator_size);
   } else {
     int flap_revealed, content_revealed, separator_revealed;
     int flap_hidden, content_hidden, separator_hidden;
 
-    compute_sizes (self, width, height, folded, TRUE, &flap_revealed, &content_revealed, &separator_revealed);
-    compute_sizes (self, width, height, folded, FALSE, &flap_hidden, &content_hidden, &separator_hidden);
+    get_sizes (self, width, height, folded, TRUE, &flap_revealed, &content_revealed, &separator_revealed);
+    get_sizes (self, width, height, folded, FALSE, &flap_hidden, &content_hidden, &separator_hidden);
 
     *flap_size =
       (int) round (adw_lerp (flap_hidden, flap_revealed,
@@ -831,6 +936,47 @@ allocate_child (AdwFlap   *self,
   gtk_widget_size_allocate (info->widget, &info->allocation, baseline);
 }
 
+/* Allocates @info at a size that doesn't change during the transition,
+ * moving it with a transform instead. The part that doesn't fit into the
+ * visible allocation extends towards the start when @extend_to_start is
+ * `TRUE` (assuming the flap is at the start), and towards the end otherwise. */
+static void
+allocate_child_stable (AdwFlap   *self,
+                       ChildInfo *info,
+                       int        stable_size,
+                       gboolean   extend_to_start,
+                       int        baseline)
+{
+  GtkAllocation alloc;
+
+  if (!info->widget || !gtk_widget_should_layout (info->widget))
+    return;
+
+  alloc = info->allocation;
+
+  if (self->flap_position != get_start_or_end (self))
+    extend_to_start = !extend_to_start;
+
+  if (self->orientation == GTK_ORIENTATION_HORIZONTAL) {
+    int width = MAX (alloc.width, stable_size);
+
+    if (extend_to_start)
+      alloc.x -= width - alloc.width;
+
+    alloc.width = width;
+  } else {
+    int height = MAX (alloc.height, stable_size);
+
+    if (extend_to_start)
+      alloc.y -= height - alloc.height;
+
+    alloc.height = height;
+  }
+
+  gtk_widget_allocate (info->widget, alloc.width, alloc.height, baseline,
+                       gsk_transform_translate (NULL, &GRAPHENE_POINT_INIT (alloc.x, alloc.y)));
+}
+
 static void
 allocate_shadow (AdwFlap *self,
                  int      width,
@@ -895,8 +1041,14 @@ adw_flap_size_allocate (GtkWidget *widget,
                         int        baseline)
 {
   AdwFlap *self = ADW_FLAP (widget);
+  gboolean stable = use_stable_allocation (self);
+
+  ADW_LAYOUT_STATS_ALLOCATE (widget);
 
-  if (self->fold_policy == ADW_FLAP_FOLD_POLICY_AUTO) {
+  /* The children have already been measured for this size, there's no need
+   * to check whether to fold again */
+  if (self->fold_policy == ADW_FLAP_FOLD_POLICY_AUTO &&
+      !(stable && sizes_cache_is_valid (self, width, height))) {
     GtkRequisition flap_min = { 0, 0 };
     GtkRequisition content_min = { 0, 0 };
     GtkRequisition separator_min = { 0, 0 };
@@ -921,9 +1073,22 @@ adw_flap_size_allocate (GtkWidget *widget,
                       &self->content.allocation,
                       &self->separator.allocation);
 
-  allocate_child (self, &self->content, baseline);
-  allocate_child (self, &self->separator, baseline);
-  allocate_child (self, &self->flap, baseline);
+  /* set_folded() may have started or finished an animation */
+  stable = use_stable_allocation (self);
+
+  if (stable) {
+    gboolean content_above_flap = transition_is_content_above_flap (self);
+
+    allocate_child_stable (self, &self->content, self->stable_sizes.content,
+                           !content_above_flap, baseline);
+    allocate_child (self, &self->separator, baseline);
+    allocate_child_stable (self, &self->flap, self->stable_sizes.flap,
+                           TRUE, baseline);
+  } else {
+    allocate_child (self, &self->content, baseline);
+    allocate_child (self, &self->separator, baseline);
+    allocate_child (self, &self->flap, baseline);
+  }
 
   if (gtk_widget_should_layout (self->shield))
     gtk_widget_size_allocate (self->shield, &self->content.allocation, baseline);
@@ -941,12 +1106,17 @@ adw_flap_measure (GtkWidget      *widget,
                   int            *natural_baseline)
 {
   AdwFlap *self = ADW_FLAP (widget);
-
   int content_min = 0, content_nat = 0;
   int flap_min = 0, flap_nat = 0;
   int separator_min = 0, separator_nat = 0;
   int min, nat;
 
+  ADW_LAYOUT_STATS_MEASURE (widget);
+
+  /* Being measured again means a child may have changed its size, so the
+   * sizes cached for stable allocation can't be trusted anymore */
+  self->sizes_cached = FALSE;
+
   if (self->content.widget)
     get_preferred_size (self->content.widget, orientation, &content_min, &content_nat);
 
@@ -1147,6 +1317,9 @@ adw_flap_get_property (GObject    *object,
   case PROP_SWIPE_TO_CLOSE:
     g_value_set_boolean (value, adw_flap_get_swipe_to_close (self));
     break;
+  case PROP_STABLE_ALLOCATION:
+    g_value_set_boolean (value, adw_flap_get_stable_allocation (self));
+    break;
   case PROP_ORIENTATION:
     g_value_set_enum (value, self->orientation);
     break;
@@ -1203,6 +1376,9 @@ adw_flap_set_property (GObject      *object,
   case PROP_SWIPE_TO_CLOSE:
     adw_flap_set_swipe_to_close (self, g_value_get_boolean (value));
     break;
+  case PROP_STABLE_ALLOCATION:
+    adw_flap_set_stable_allocation (self, g_value_get_boolean (value));
+    break;
   case PROP_ORIENTATION:
     set_orientation (self, g_value_get_enum (value));
     break;
@@ -1497,6 +1673,27 @@ adw_flap_class_init (AdwFlapClass *klass)
                           TRUE,
                           G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * AdwFlap:stable-allocation: (attributes org.gtk.Property.get=adw_flap_get_stable_allocation org.gtk.Property.set=adw_flap_set_stable_allocation)
+   *
+   * Whether the children keep their size during reveal and fold transitions.
+   *
+   * If `TRUE`, the children are measured once when a transition starts and
+   * are moved instead of being resized on every frame. The content is
+   * allocated at its final size once the transition is over.
+   *
+   * This is useful when the content is expensive to lay out, at the cost of
+   * the content not being resized along with the transition.
+   *
+   * Since: 1.0
+   */
+  props[PROP_STABLE_ALLOCATION] =
+    g_param_spec_boolean ("stable-allocation",
+                          "Stable Allocation",
+                          "Whether the children keep their size during transitions",
+                          FALSE,
+                          G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (object_class, LAST_PROP, props);
 
   g_object_class_override_property (object_class,
@@ -2406,3 +2603,49 @@ adw_flap_set_swipe_to_close (AdwFlap  *self,
 
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_SWIPE_TO_CLOSE]);
 }
+
+/**
+ * adw_flap_get_stable_allocation: (attributes org.gtk.Method.get_property=stable-allocation)
+ * @self: a `AdwFlap`
+ *
+ * Gets whether the children of @self keep their size during transitions.
+ *
+ * Returns: `TRUE` if the children keep their size during transitions
+ *
+ * Since: 1.0
+ */
+gboolean
+adw_flap_get_stable_allocation (AdwFlap *self)
+{
+  g_return_val_if_fail (ADW_IS_FLAP (self), FALSE);
+
+  return self->stable_allocation;
+}
+
+/**
+ * adw_flap_set_stable_allocation: (attributes org.gtk.Method.set_property=stable-allocation)
+ * @self: a `AdwFlap`
+ * @stable_allocation: whether the children keep their size during transitions
+ *
+ * Sets whether the children of @self keep their size during transitions.
+ *
+ * Since: 1.0
+ */
+void
+adw_flap_set_stable_allocation (AdwFlap  *self,
+                                gboolean  stable_allocation)
+{
+  g_return_if_fail (ADW_IS_FLAP (self));
+
+  stable_allocation = !!stable_allocation;
+
+  if (self->stable_allocation == stable_allocation)
+    return;
+
+  self->stable_allocation = stable_allocation;
+  self->sizes_cached = FALSE;
+
+  gtk_widget_queue_allocate (GTK_WIDGET (self));
+
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_STABLE_ALLOCATION]);
+}
@@ -121,4 +121,10 @@ ADW_AVAILABLE_IN_ALL
 void     adw_flap_set_swipe_to_close (AdwFlap  *self,
                                       gboolean  swipe_to_close);
 
+ADW_AVAILABLE_IN_ALL
+gboolean adw_flap_get_stable_allocation (AdwFlap  *self);
+ADW_AVAILABLE_IN_ALL
+void     adw_flap_set_stable_allocation (AdwFlap  *self,
+                                         gboolean  stable_allocation);
+
 G_END_DECLS
@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#pragma once
+
+#if !defined(_ADWAITA_INSIDE) && !defined(ADWAITA_COMPILATION)
+#error "Only <adwaita.h> can be included directly."
+#endif
+
+#include "adw-version.h"
+
+#include <gtk/gtk.h>
+
+G_BEGIN_DECLS
+
+gint64 adw_frame_clock_get_frame_time       (GtkWidget       *widget);
+guint  adw_frame_clock_add_tick_callback    (GtkWidget       *widget,
+                                             GtkTickCallback  callback,
+                                             gpointer         user_data,
+                                             GDestroyNotify   notify);
+void   adw_frame_clock_remove_tick_callback (GtkWidget       *widget,
+                                             guint            id);
+void   adw_frame_clock_get_stats            (guint           *n_callbacks,
+                                             guint64         *n_runs);
+
+/* Only meant for tests and benchmarks */
+void     adw_frame_clock_set_virtual          (gboolean enabled);
+gboolean adw_frame_clock_get_virtual          (void);
+void     adw_frame_clock_advance              (gint64   usec);
+guint    adw_frame_clock_get_n_tick_callbacks (void);
+
+G_END_DECLS
@@ -0,0 +1,335 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "config.h"
+
+#include "adw-frame-clock-private.h"
+
+#include "adw-animation-private.h"
+
+/* Animations and transitions get their frame times and tick callbacks from
+ * here rather than from the widget's GdkFrameClock directly. Normally this
+ * just forwards to GTK, but tests and benchmarks can switch to a virtual clock
+ * that only moves when adw_frame_clock_advance() is called, and runs every
+ * tick callback once per call, so that animations can be stepped frame by
+ * frame deterministically, without depending on wall-clock time or on the
+ * compositor.
+ *
+ * With the virtual clock, animations also run on widgets that aren't mapped,
+ * so tests don't need to show a window.
+ *
+ * The virtual clock must be enabled before any animation starts and stay
+ * enabled until they are all finished, as tick callbacks added to one clock
+ * can't be moved to the other.
+ *
+ * Both clocks skip tick callbacks as needed to honor the animation frame rate
+ * limit, see adw_set_animation_frame_rate_limit().
+ */
+
+/* How early a tick callback may run relative to the frame rate limit, to
+ * absorb jitter in frame times */
+#define FRAME_RATE_LIMIT_SLACK 2000 /* us */
+
+typedef struct {
+  guint id;
+  GtkWidget *widget;
+  GtkTickCallback callback;
+  gpointer user_data;
+  GDestroyNotify notify;
+  gboolean removed;
+  gint64 next_run_time;
+} TickCallback;
+
+/* Wraps a tick callback on the real frame clock, to count it */
+typedef struct {
+  GtkTickCallback callback;
+  gpointer user_data;
+  GDestroyNotify notify;
+  gint64 next_run_time;
+} RealTickCallback;
+
+static gboolean virtual_clock;
+static gint64 virtual_time;
+static GList *tick_callbacks;
+static guint last_tick_id;
+static guint n_tick_callbacks;
+static int dispatch_depth;
+
+/* For the inspector */
+static guint n_real_tick_callbacks;
+static guint64 n_ticks_run;
+
+static void widget_finalized_cb (TickCallback *tick,
+                                 GObject      *widget);
+
+static void
+remove_tick (TickCallback *tick)
+{
+  if (tick->removed)
+    return;
+
+  tick->removed = TRUE;
+  n_tick_callbacks--;
+
+  if (tick->widget)
+    g_object_weak_unref (G_OBJECT (tick->widget),
+                         (GWeakNotify) widget_finalized_cb,
+                         tick);
+
+  if (tick->notify)
+    tick->notify (tick->user_data);
+}
+
+static void
+sweep_removed_ticks (void)
+{
+  GList *l = tick_callbacks;
+
+  if (dispatch_depth > 0)
+    return;
+
+  while (l) {
+    GList *next = l->next;
+    TickCallback *tick = l->data;
+
+    if (tick->removed) {
+      tick_callbacks = g_list_delete_link (tick_callbacks, l);
+      g_free (tick);
+    }
+
+    l = next;
+  }
+}
+
+static void
+widget_finalized_cb (TickCallback *tick,
+                     GObject      *widget)
+{
+  tick->widget = NULL;
+
+  remove_tick (tick);
+  sweep_removed_ticks ();
+}
+
+static gboolean
+should_skip_tick (GtkWidget *widget,
+                  gint64    *next_run_time,
+                  gint64     frame_time)
+{
+  gint64 interval = adw_animation_get_frame_interval (widget);
+
+  if (interval < 0)
+    return TRUE;
+
+  if (interval == 0)
+    return FALSE;
+
+  if (frame_time + FRAME_RATE_LIMIT_SLACK < *next_run_time)
+    return TRUE;
+
+  /* Stay on the same schedule unless we fell too far behind it */
+  *next_run_time = MAX (*next_run_time, frame_time - interval / 2) + interval;
+
+  return FALSE;
+}
+
+static gboolean
+real_tick_cb (GtkWidget     *widget,
+              GdkFrameClock *frame_clock,
+              gpointer       user_data)
+{
+  RealTickCallback *tick = user_data;
+
+  if (should_skip_tick (widget, &tick->next_run_time,
+                        gdk_frame_clock_get_frame_time (frame_clock)))
+    return G_SOURCE_CONTINUE;
+
+  n_ticks_run++;
+
+  return tick->callback (widget, frame_clock, tick->user_data);
+}
+
+static void
+real_tick_free (gpointer user_data)
+{
+  RealTickCallback *tick = user_data;
+
+  n_real_tick_callbacks--;
+
+  if (tick->notify)
+    tick->notify (tick->user_data);
+
+  g_free (tick);
+}
+
+gint64
+adw_frame_clock_get_frame_time (GtkWidget *widget)
+{
+  GdkFrameClock *frame_clock;
+
+  g_assert (GTK_IS_WIDGET (widget));
+
+  if (virtual_clock)
+    return virtual_time;
+
+  frame_clock = gtk_widget_get_frame_clock (widget);
+
+  if (frame_clock)
+    return gdk_frame_clock_get_frame_time (frame_clock);
+
+  return g_get_monotonic_time ();
+}
+
+guint
+adw_frame_clock_add_tick_callback (GtkWidget       *widget,
+                                   GtkTickCallback  callback,
+                                   gpointer         user_data,
+                                   GDestroyNotify   notify)
+{
+  TickCallback *tick;
+
+  g_assert (GTK_IS_WIDGET (widget));
+  g_assert (callback != NULL);
+
+  if (!virtual_clock) {
+    RealTickCallback *real_tick = g_new0 (RealTickCallback, 1);
+
+    real_tick->callback = callback;
+    real_tick->user_data = user_data;
+    real_tick->notify = notify;
+
+    n_real_tick_callbacks++;
+
+    return gtk_widget_add_tick_callback (widget, real_tick_cb, real_tick, real_tick_free);
+  }
+
+  tick = g_new0 (TickCallback, 1);
+  tick->id = ++last_tick_id;
+  tick->widget = widget;
+  tick->callback = callback;
+  tick->user_data = user_data;
+  tick->notify = notify;
+
+  g_object_weak_ref (G_OBJECT (widget),
+                     (GWeakNotify) widget_finalized_cb,
+                     tick);
+
+  tick_callbacks = g_list_append (tick_callbacks, tick);
+  n_tick_callbacks++;
+
+  return tick->id;
+}
+
+void
+adw_frame_clock_remove_tick_callback (GtkWidget *widget,
+                                      guint      id)
+{
+  GList *l;
+
+  g_assert (GTK_IS_WIDGET (widget));
+
+  if (!virtual_clock) {
+    gtk_widget_remove_tick_callback (widget, id);
+
+    return;
+  }
+
+  for (l = tick_callbacks; l; l = l->next) {
+    TickCallback *tick = l->data;
+
+    if (tick->id == id && tick->widget == widget && !tick->removed) {
+      remove_tick (tick);
+      sweep_removed_ticks ();
+
+      return;
+    }
+  }
+}
+
+/* The virtual clock starts at 0 every time it's enabled */
+void
+adw_frame_clock_set_virtual (gboolean enabled)
+{
+  enabled = !!enabled;
+
+  if (enabled == virtual_clock)
+    return;
+
+  g_return_if_fail (n_tick_callbacks == 0);
+
+  virtual_clock = enabled;
+  virtual_time = 0;
+  last_tick_id = 0;
+}
+
+gboolean
+adw_frame_clock_get_virtual (void)
+{
+  return virtual_clock;
+}
+
+/* Advances the virtual clock and runs a single frame: every tick callback
+ * that was added before it is run once, in the order they were added. */
+void
+adw_frame_clock_advance (gint64 usec)
+{
+  GList *l, *last;
+
+  g_return_if_fail (virtual_clock);
+  g_return_if_fail (usec >= 0);
+
+  virtual_time += usec;
+
+  /* Like GTK, callbacks added during this frame only run starting from the
+   * next one */
+  last = g_list_last (tick_callbacks);
+
+  if (!last)
+    return;
+
+  dispatch_depth++;
+
+  for (l = tick_callbacks; l; l = l->next) {
+    TickCallback *tick = l->data;
+
+    if (!tick->removed &&
+        !should_skip_tick (tick->widget, &tick->next_run_time, virtual_time)) {
+      g_autoptr (GtkWidget) widget = g_object_ref (tick->widget);
+
+      n_ticks_run++;
+
+      if (tick->callback (widget,
+                          gtk_widget_get_frame_clock (widget),
+                          tick->user_data) == G_SOURCE_REMOVE)
+        remove_tick (tick);
+    }
+
+    if (l == last)
+      break;
+  }
+
+  dispatch_depth--;
+
+  sweep_removed_ticks ();
+}
+
+/* This is 0 once every animation on the virtual clock is finished */
+guint
+adw_frame_clock_get_n_tick_callbacks (void)
+{
+  return n_tick_callbacks;
+}
+
+void
+adw_frame_clock_get_stats (guint   *n_callbacks,
+                           guint64 *n_runs)
+{
+  if (n_callbacks)
+    *n_callbacks = virtual_clock ? n_tick_callbacks : n_real_tick_callbacks;
+
+  if (n_runs)
+    *n_runs = n_ticks_run;
+}
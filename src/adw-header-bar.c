@@ -119,6 +119,17 @@
 #define MOBILE_WINDOW_WIDTH  480
 #define MOBILE_WINDOW_HEIGHT 800
 
+#define WINDOW_DECORATION_KEY "adw-header-bar-window-decoration"
+
+/* Which sides of the default decoration layout have buttons, shared by all
+ * header bars of a window. It's only used to decide which GtkWindowControls to
+ * create, the created controls still parse the layout themselves. */
+typedef struct {
+  GtkSettings *settings;
+  GSList *header_bars;
+  gboolean has_buttons[2]; /* Indexed by GtkPackType */
+} WindowDecoration;
+
 struct _AdwHeaderBar {
   GtkWidget parent_instance;
 
@@ -137,6 +148,7 @@ struct _AdwHeaderBar {
   GtkWidget *end_window_controls;
 
   char *decoration_layout;
+  WindowDecoration *window_decoration;
 
   guint show_start_title_buttons : 1;
   guint show_end_title_buttons : 1;
@@ -196,6 +208,146 @@ create_end_window_controls (AdwHeaderBar *self)
   self->end_window_controls = controls;
 }
 
+static void
+parse_decoration_layout (const char *layout,
+                         gboolean    has_buttons[2])
+{
+  g_auto (GStrv) sides = NULL;
+  int i, j;
+
+  has_buttons[GTK_PACK_START] = FALSE;
+  has_buttons[GTK_PACK_END] = FALSE;
+
+  if (!layout)
+    return;
+
+  /* Same format as GtkWindowControls: "start,buttons:end,buttons" */
+  sides = g_strsplit (layout, ":", 2);
+
+  for (i = 0; i < 2 && sides[i]; i++) {
+    g_auto (GStrv) buttons = g_strsplit (sides[i], ",", -1);
+
+    for (j = 0; buttons[j]; j++) {
+      if (!g_strcmp0 (buttons[j], "icon") ||
+          !g_strcmp0 (buttons[j], "minimize") ||
+          !g_strcmp0 (buttons[j], "maximize") ||
+          !g_strcmp0 (buttons[j], "close")) {
+        has_buttons[i] = TRUE;
+
+        break;
+      }
+    }
+  }
+}
+
+static void
+update_window_controls (AdwHeaderBar *self)
+{
+  gboolean has_buttons[2] = { FALSE, FALSE };
+
+  if (!self->start_box || !self->end_box)
+    return;
+
+  if (self->decoration_layout)
+    parse_decoration_layout (self->decoration_layout, has_buttons);
+  else if (self->window_decoration) {
+    has_buttons[GTK_PACK_START] = self->window_decoration->has_buttons[GTK_PACK_START];
+    has_buttons[GTK_PACK_END] = self->window_decoration->has_buttons[GTK_PACK_END];
+  }
+
+  /* Only create the controls that have buttons to show */
+  if (self->show_start_title_buttons && has_buttons[GTK_PACK_START]) {
+    if (!self->start_window_controls)
+      create_start_window_controls (self);
+  } else if (self->start_window_controls) {
+    gtk_box_remove (GTK_BOX (self->start_box), self->start_window_controls);
+    self->start_window_controls = NULL;
+  }
+
+  if (self->show_end_title_buttons && has_buttons[GTK_PACK_END]) {
+    if (!self->end_window_controls)
+      create_end_window_controls (self);
+  } else if (self->end_window_controls) {
+    gtk_box_remove (GTK_BOX (self->end_box), self->end_window_controls);
+    self->end_window_controls = NULL;
+  }
+}
+
+static void
+window_decoration_parse_layout (WindowDecoration *decoration)
+{
+  g_autofree char *layout = NULL;
+
+  g_object_get (decoration->settings, "gtk-decoration-layout", &layout, NULL);
+
+  parse_decoration_layout (layout, decoration->has_buttons);
+}
+
+static void
+window_decoration_layout_changed_cb (WindowDecoration *decoration)
+{
+  GSList *l;
+
+  window_decoration_parse_layout (decoration);
+
+  for (l = decoration->header_bars; l; l = l->next)
+    update_window_controls (l->data);
+}
+
+static void
+window_decoration_free (WindowDecoration *decoration)
+{
+  g_signal_handlers_disconnect_by_func (decoration->settings,
+                                        window_decoration_layout_changed_cb,
+                                        decoration);
+
+  g_object_unref (decoration->settings);
+  g_slist_free (decoration->header_bars);
+  g_free (decoration);
+}
+
+static void
+attach_window_decoration (AdwHeaderBar *self,
+                          GtkRoot      *root)
+{
+  WindowDecoration *decoration;
+
+  decoration = g_object_get_data (G_OBJECT (root), WINDOW_DECORATION_KEY);
+
+  if (!decoration) {
+    decoration = g_new0 (WindowDecoration, 1);
+    decoration->settings = g_object_ref (gtk_widget_get_settings (GTK_WIDGET (root)));
+
+    g_signal_connect_swapped (decoration->settings, "notify::gtk-decoration-layout",
+                              G_CALLBACK (window_decoration_layout_changed_cb),
+                              decoration);
+
+    window_decoration_parse_layout (decoration);
+
+    g_object_set_data_full (G_OBJECT (root), WINDOW_DECORATION_KEY, decoration,
+                            (GDestroyNotify) window_decoration_free);
+  }
+
+  decoration->header_bars = g_slist_prepend (decoration->header_bars, self);
+  self->window_decoration = decoration;
+}
+
+static void
+detach_window_decoration (AdwHeaderBar *self,
+                          GtkRoot      *root)
+{
+  WindowDecoration *decoration = self->window_decoration;
+
+  if (!decoration)
+    return;
+
+  self->window_decoration = NULL;
+  decoration->header_bars = g_slist_remove (decoration->header_bars, self);
+
+  if (!decoration->header_bars)
+    g_object_set_data (G_OBJECT (root), WINDOW_DECORATION_KEY, NULL);
+}
+
 static void
 update_title (AdwHeaderBar *self)
 {
@@ -244,6 +396,7 @@ construct_title_label (AdwHeaderBar *self)
 static void
 adw_header_bar_root (GtkWidget *widget)
 {
+  AdwHeaderBar *self = ADW_HEADER_BAR (widget);
   GtkWidget *root;
 
   GTK_WIDGET_CLASS (adw_header_bar_parent_class)->root (widget);
@@ -254,7 +407,10 @@ adw_header_bar_root (GtkWidget *widget)
     g_signal_connect_swapped (root, "notify::title",
                               G_CALLBACK (update_title), widget);
 
-  update_title (ADW_HEADER_BAR (widget));
+  attach_window_decoration (self, GTK_ROOT (root));
+
+  update_title (self);
+  update_window_controls (self);
 }
 
 static void
@@ -263,6 +419,9 @@ adw_header_bar_unroot (GtkWidget *widget)
   g_signal_handlers_disconnect_by_func (gtk_widget_get_root (widget),
                                         update_title, widget);
 
+  detach_window_decoration (ADW_HEADER_BAR (widget),
+                            gtk_widget_get_root (widget));
+
   GTK_WIDGET_CLASS (adw_header_bar_parent_class)->unroot (widget);
 }
 
@@ -572,8 +731,6 @@ adw_header_bar_init (AdwHeaderBar *self)
   self->size_group = gtk_size_group_new (GTK_SIZE_GROUP_HORIZONTAL);
 
   construct_title_label (self);
-  create_start_window_controls (self);
-  create_end_window_controls (self);
 }
 
 static void
@@ -777,14 +934,7 @@ adw_header_bar_set_show_start_title_buttons (AdwHeaderBar *self,
 
   self->show_start_title_buttons = setting;
 
-  if (self->start_box) {
-    if (setting) {
-      create_start_window_controls (self);
-    } else if (self->start_box && self->start_window_controls) {
-      gtk_box_remove (GTK_BOX (self->start_box), self->start_window_controls);
-      self->start_window_controls = NULL;
-    }
-  }
+  update_window_controls (self);
 
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_SHOW_START_TITLE_BUTTONS]);
 }
@@ -829,14 +979,7 @@ adw_header_bar_set_show_end_title_buttons (AdwHeaderBar *self,
 
   self->show_end_title_buttons = setting;
 
-  if (self->end_box) {
-    if (setting) {
-      create_end_window_controls (self);
-    } else if (self->end_box && self->end_window_controls) {
-      gtk_box_remove (GTK_BOX (self->end_box), self->end_window_controls);
-      self->end_window_controls = NULL;
-    }
-  }
+  update_window_controls (self);
 
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_SHOW_END_TITLE_BUTTONS]);
 }
@@ -859,6 +1002,8 @@ adw_header_bar_set_decoration_layout (AdwHeaderBar *self,
   g_clear_pointer (&self->decoration_layout, g_free);
   self->decoration_layout = g_strdup (layout);
 
+  update_window_controls (self);
+
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_DECORATION_LAYOUT]);
 }
 
@@ -9,6 +9,7 @@
 #include "config.h"
 #include "adw-indicator-bin-private.h"
 
+#include "adw-fade-private.h"
 #include "adw-gizmo-private.h"
 
 /**
@@ -35,6 +36,8 @@ struct _AdwIndicatorBin
 
   GskGLShader *shader;
   gboolean shader_compiled;
+
+  AdwFadeCache mask_cache;
 };
 
 static void adw_indicator_bin_buildable_init (GtkBuildableIface *iface);
@@ -62,7 +65,7 @@ ensure_shader (AdwIndicatorBin *self)
   GskRenderer *renderer;
   g_autoptr (GError) error = NULL;
 
-  if (self->shader)
+  if (self->shader || adw_fade_shaders_disabled ())
     return;
 
   self->shader = gsk_gl_shader_new_from_resource ("/org/gnome/Adwaita/glsl/mask.glsl");
@@ -174,17 +177,35 @@ adw_indicator_bin_snapshot (GtkWidget   *widget,
       gsk_render_node_get_bounds (child_node, &bounds);
       gtk_snapshot_push_gl_shader (snapshot, self->shader, &bounds,
                                    gsk_gl_shader_format_args (self->shader, NULL));
-    }
 
-    gtk_snapshot_append_node (snapshot, child_node);
-
-    if (self->shader_compiled) {
+      gtk_snapshot_append_node (snapshot, child_node);
       gtk_snapshot_gl_shader_pop_texture (snapshot);
 
       gtk_widget_snapshot_child (widget, self->mask, snapshot);
       gtk_snapshot_gl_shader_pop_texture (snapshot);
 
       gtk_snapshot_pop (snapshot);
+    } else {
+#if ADW_HAS_MASK_NODES
+      /* Same as glsl/mask.glsl: the mask cuts the indicator out of the child */
+      gtk_snapshot_push_mask (snapshot, GSK_MASK_MODE_INVERTED_ALPHA);
+      gtk_widget_snapshot_child (widget, self->mask, snapshot);
+      gtk_snapshot_pop (snapshot);
+
+      gtk_snapshot_append_node (snapshot, child_node);
+      gtk_snapshot_pop (snapshot);
+#else
+      GtkSnapshot *mask_snapshot;
+      g_autoptr (GskRenderNode) mask_node = NULL;
+
+      mask_snapshot = gtk_snapshot_new ();
+      gtk_widget_snapshot_child (widget, self->mask, mask_snapshot);
+      mask_node = gtk_snapshot_free_to_node (mask_snapshot);
+
+      adw_mask_append_cut_out (snapshot, &self->mask_cache,
+                               gtk_widget_get_scale_factor (widget),
+                               child_node, mask_node);
+#endif
     }
   }
 
@@ -249,6 +270,7 @@ adw_indicator_bin_dispose (GObject *object)
   AdwIndicatorBin *self = ADW_INDICATOR_BIN (object);
 
   g_clear_object (&self->shader);
+  adw_fade_cache_clear (&self->mask_cache);
   g_clear_pointer (&self->child, gtk_widget_unparent);
   g_clear_pointer (&self->mask, gtk_widget_unparent);
   g_clear_pointer (&self->indicator, gtk_widget_unparent);
@@ -0,0 +1,314 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "config.h"
+#include "adw-inspector-page-private.h"
+
+#include "adw-animation-private.h"
+#include "adw-frame-clock-private.h"
+#include "adw-swipe-tracker-private.h"
+#include "adw-tab-icon-cache-private.h"
+#include "adw-tab-view-private.h"
+
+/* A page for GtkInspector showing what Libadwaita is doing at runtime:
+ * running animations, tick callbacks, swipe trackers, tab views and their
+ * thumbnails, and the tab icon cache. It's refreshed once per second while
+ * it's mapped, and does nothing otherwise.
+ */
+
+#define REFRESH_INTERVAL 1000
+
+struct _AdwInspectorPage
+{
+  AdwBin parent_instance;
+
+  GtkWidget *animations_label;
+  GtkWidget *ticks_label;
+  GtkWidget *swipe_trackers_label;
+  GtkWidget *tab_views_label;
+  GtkWidget *icon_cache_label;
+
+  guint refresh_id;
+  guint64 last_n_ticks_run;
+};
+
+G_DEFINE_TYPE (AdwInspectorPage, adw_inspector_page, ADW_TYPE_BIN)
+
+enum {
+  PROP_0,
+  PROP_TITLE,
+  PROP_OBJECT,
+  LAST_PROP
+};
+
+static GParamSpec *props[LAST_PROP];
+
+static GtkWidget *
+add_section (GtkBox     *box,
+             const char *title)
+{
+  GtkWidget *heading, *label;
+
+  heading = gtk_label_new (title);
+  gtk_label_set_xalign (GTK_LABEL (heading), 0);
+  gtk_widget_add_css_class (heading, "heading");
+  gtk_box_append (box, heading);
+
+  label = gtk_label_new (NULL);
+  gtk_label_set_xalign (GTK_LABEL (label), 0);
+  gtk_label_set_selectable (GTK_LABEL (label), TRUE);
+  gtk_label_set_wrap (GTK_LABEL (label), TRUE);
+  gtk_widget_add_css_class (label, "monospace");
+  gtk_widget_set_margin_bottom (label, 12);
+  gtk_box_append (box, label);
+
+  return label;
+}
+
+static void
+set_section_text (GtkWidget *label,
+                  GString   *str)
+{
+  if (str->len == 0)
+    g_string_append (str, "None");
+  else if (str->str[str->len - 1] == '\n')
+    g_string_truncate (str, str->len - 1);
+
+  gtk_label_set_text (GTK_LABEL (label), str->str);
+}
+
+static void
+update_animations (AdwInspectorPage *self)
+{
+  g_autoptr (GString) str = g_string_new (NULL);
+  GList *l;
+
+  for (l = adw_animation_get_running (); l; l = l->next) {
+    AdwAnimation *animation = l->data;
+    GtkWidget *widget = adw_animation_get_widget (animation);
+
+    g_string_append_printf (str, "%s %p: %.3f\n",
+                            widget ? G_OBJECT_TYPE_NAME (widget) : "(none)",
+                            widget,
+                            adw_animation_get_value (animation));
+  }
+
+  set_section_text (self->animations_label, str);
+}
+
+static void
+update_ticks (AdwInspectorPage *self)
+{
+  g_autoptr (GString) str = g_string_new (NULL);
+  guint n_callbacks;
+  guint64 n_runs;
+
+  adw_frame_clock_get_stats (&n_callbacks, &n_runs);
+
+  g_string_append_printf (str, "Active: %u\n", n_callbacks);
+  g_string_append_printf (str, "Runs in the last second: %" G_GUINT64_FORMAT,
+                          n_runs - self->last_n_ticks_run);
+
+  self->last_n_ticks_run = n_runs;
+
+  set_section_text (self->ticks_label, str);
+}
+
+static void
+update_swipe_trackers (AdwInspectorPage *self)
+{
+  g_autoptr (GString) str = g_string_new (NULL);
+  GSList *l;
+
+  for (l = adw_swipe_tracker_get_all (); l; l = l->next) {
+    AdwSwipeTracker *tracker = l->data;
+    AdwSwipeable *swipeable = adw_swipe_tracker_get_swipeable (tracker);
+
+    g_string_append_printf (str, "%s %p: %s, %.3f\n",
+                            swipeable ? G_OBJECT_TYPE_NAME (swipeable) : "(none)",
+                            swipeable,
+                            adw_swipe_tracker_get_state_name (tracker),
+                            adw_swipe_tracker_get_progress (tracker));
+  }
+
+  set_section_text (self->swipe_trackers_label, str);
+}
+
+static void
+update_tab_views (AdwInspectorPage *self)
+{
+  g_autoptr (GString) str = g_string_new (NULL);
+  guint n_thumbnails;
+  gsize memory;
+  GSList *l;
+
+  for (l = adw_tab_view_get_all (); l; l = l->next) {
+    AdwTabView *view = l->data;
+    AdwTabPage *selected = adw_tab_view_get_selected_page (view);
+
+    g_string_append_printf (str, "%p: %d pages, %d pinned, selected: %s\n",
+                            view,
+                            adw_tab_view_get_n_pages (view),
+                            adw_tab_view_get_n_pinned_pages (view),
+                            selected ? adw_tab_page_get_title (selected) : "(none)");
+  }
+
+  adw_tab_view_get_thumbnail_stats (&n_thumbnails, &memory);
+
+  g_string_append_printf (str, "Thumbnails: %u, %.2f MiB",
+                          n_thumbnails, memory / (1024.0 * 1024.0));
+
+  set_section_text (self->tab_views_label, str);
+}
+
+static void
+update_icon_cache (AdwInspectorPage *self)
+{
+  g_autoptr (GString) str = g_string_new (NULL);
+  guint hits, misses;
+
+  adw_tab_icon_cache_get_stats (&hits, &misses);
+
+  g_string_append_printf (str, "Hits: %u, misses: %u", hits, misses);
+
+  if (hits + misses > 0)
+    g_string_append_printf (str, ", hit rate: %.1f%%",
+                            100.0 * hits / (hits + misses));
+
+  set_section_text (self->icon_cache_label, str);
+}
+
+static gboolean
+refresh_cb (AdwInspectorPage *self)
+{
+  update_animations (self);
+  update_ticks (self);
+  update_swipe_trackers (self);
+  update_tab_views (self);
+  update_icon_cache (self);
+
+  return G_SOURCE_CONTINUE;
+}
+
+static void
+adw_inspector_page_map (GtkWidget *widget)
+{
+  AdwInspectorPage *self = ADW_INSPECTOR_PAGE (widget);
+
+  GTK_WIDGET_CLASS (adw_inspector_page_parent_class)->map (widget);
+
+  adw_frame_clock_get_stats (NULL, &self->last_n_ticks_run);
+  refresh_cb (self);
+
+  self->refresh_id = g_timeout_add (REFRESH_INTERVAL, (GSourceFunc) refresh_cb, self);
+}
+
+static void
+adw_inspector_page_unmap (GtkWidget *widget)
+{
+  AdwInspectorPage *self = ADW_INSPECTOR_PAGE (widget);
+
+  g_clear_handle_id (&self->refresh_id, g_source_remove);
+
+  GTK_WIDGET_CLASS (adw_inspector_page_parent_class)->unmap (widget);
+}
+
+static void
+adw_inspector_page_dispose (GObject *object)
+{
+  AdwInspectorPage *self = ADW_INSPECTOR_PAGE (object);
+
+  g_clear_handle_id (&self->refresh_id, g_source_remove);
+
+  G_OBJECT_CLASS (adw_inspector_page_parent_class)->dispose (object);
+}
+
+static void
+adw_inspector_page_get_property (GObject    *object,
+                                 guint       prop_id,
+                                 GValue     *value,
+                                 GParamSpec *pspec)
+{
+  switch (prop_id) {
+  case PROP_TITLE:
+    g_value_set_string (value, "Libadwaita");
+    break;
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+  }
+}
+
+static void
+adw_inspector_page_set_property (GObject      *object,
+                                 guint         prop_id,
+                                 const GValue *value,
+                                 GParamSpec   *pspec)
+{
+  switch (prop_id) {
+  case PROP_OBJECT:
+    /* The statistics are global, nothing depends on the inspected object */
+    break;
+  default:
+    G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+  }
+}
+
+static void
+adw_inspector_page_class_init (AdwInspectorPageClass *klass)
+{
+  GObjectClass *object_class = G_OBJECT_CLASS (klass);
+  GtkWidgetClass *widget_class = GTK_WIDGET_CLASS (klass);
+
+  object_class->dispose = adw_inspector_page_dispose;
+  object_class->get_property = adw_inspector_page_get_property;
+  object_class->set_property = adw_inspector_page_set_property;
+
+  widget_class->map = adw_inspector_page_map;
+  widget_class->unmap = adw_inspector_page_unmap;
+
+  props[PROP_TITLE] =
+    g_param_spec_string ("title",
+                         "Title",
+                         "The title of the inspector page",
+                         NULL,
+                         G_PARAM_READABLE);
+
+  /* GtkInspector sets this on every page when an object is selected */
+  props[PROP_OBJECT] =
+    g_param_spec_object ("object",
+                         "Object",
+                         "The object selected in the inspector",
+                         G_TYPE_OBJECT,
+                         G_PARAM_WRITABLE);
+
+  g_object_class_install_properties (object_class, LAST_PROP, props);
+}
+
+static void
+adw_inspector_page_init (AdwInspectorPage *self)
+{
+  GtkWidget *scrolled_window, *box;
+
+  box = gtk_box_new (GTK_ORIENTATION_VERTICAL, 6);
+  gtk_widget_set_margin_top (box, 12);
+  gtk_widget_set_margin_bottom (box, 12);
+  gtk_widget_set_margin_start (box, 12);
+  gtk_widget_set_margin_end (box, 12);
+
+  self->animations_label = add_section (GTK_BOX (box), "Running Animations");
+  self->ticks_label = add_section (GTK_BOX (box), "Tick Callbacks");
+  self->swipe_trackers_label = add_section (GTK_BOX (box), "Swipe Trackers");
+  self->tab_views_label = add_section (GTK_BOX (box), "Tab Views");
+  self->icon_cache_label = add_section (GTK_BOX (box), "Tab Icon Cache");
+
+  scrolled_window = gtk_scrolled_window_new ();
+  gtk_scrolled_window_set_policy (GTK_SCROLLED_WINDOW (scrolled_window),
+                                  GTK_POLICY_NEVER,
+                                  GTK_POLICY_AUTOMATIC);
+  gtk_scrolled_window_set_child (GTK_SCROLLED_WINDOW (scrolled_window), box);
+
+  adw_bin_set_child (ADW_BIN (self), scrolled_window);
+}
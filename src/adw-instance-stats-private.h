@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#pragma once
+
+#if !defined(_ADWAITA_INSIDE) && !defined(ADWAITA_COMPILATION)
+#error "Only <adwaita.h> can be included directly."
+#endif
+
+#include "adw-version.h"
+
+#include <glib-object.h>
+
+G_BEGIN_DECLS
+
+void adw_instance_stats_init (void);
+
+/* Also used by benchmarks */
+gboolean adw_instance_stats_get_enabled (void);
+gsize    adw_instance_stats_get_size    (GType  type,
+                                         guint *n_instances);
+char    *adw_instance_stats_to_string   (void);
+
+G_END_DECLS
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "config.h"
+
+#include "adw-instance-stats-private.h"
+
+#include <gtk/gtk.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Setting ADW_DEBUG_INSTANCES prints the number of live instances of every
+ * libadwaita type when the application exits, along with an estimate of the
+ * memory they retain, including the GTK widgets, CSS nodes and render nodes
+ * they create. This is meant for finding leaks and tracking the cost of
+ * widgets, e.g. of a row or a tab.
+ *
+ * The counting itself is done by GObject and needs GOBJECT_DEBUG=instance-count
+ * to be set as well. The sizes only include the instance structs, not private
+ * data or anything allocated separately, so they are lower bounds.
+ */
+
+typedef struct {
+  GType type;
+  guint n_instances;
+  gsize size;
+} TypeStats;
+
+static gboolean
+check_enabled (void)
+{
+  const char *gobject_debug = g_getenv ("GOBJECT_DEBUG");
+
+  return gobject_debug && strstr (gobject_debug, "instance-count");
+}
+
+static void
+collect_stats (GType   type,
+               GArray *stats)
+{
+  g_autofree GType *children = NULL;
+  guint n_children, i;
+  int n_instances = g_type_get_instance_count (type);
+
+  if (n_instances > 0 && g_str_has_prefix (g_type_name (type), "Adw")) {
+    TypeStats type_stats;
+    GTypeQuery query;
+
+    g_type_query (type, &query);
+
+    type_stats.type = type;
+    type_stats.n_instances = n_instances;
+    type_stats.size = (gsize) n_instances * query.instance_size;
+
+    g_array_append_val (stats, type_stats);
+  }
+
+  children = g_type_children (type, &n_children);
+
+  for (i = 0; i < n_children; i++)
+    collect_stats (children[i], stats);
+}
+
+static int
+compare_stats (gconstpointer a,
+               gconstpointer b)
+{
+  const TypeStats *stats_a = a;
+  const TypeStats *stats_b = b;
+
+  if (stats_a->size != stats_b->size)
+    return stats_a->size < stats_b->size ? 1 : -1;
+
+  return g_strcmp0 (g_type_name (stats_a->type), g_type_name (stats_b->type));
+}
+
+static void
+append_total (GString    *string,
+              const char *name,
+              GType       type)
+{
+  guint n_instances;
+  gsize size;
+
+  if (!type)
+    return;
+
+  size = adw_instance_stats_get_size (type, &n_instances);
+
+  g_string_append_printf (string, "%-32s %10u %12" G_GSIZE_FORMAT "\n",
+                          name, n_instances, size);
+}
+
+static void
+print_stats (void)
+{
+  g_autofree char *report = adw_instance_stats_to_string ();
+
+  fputs (report, stderr);
+}
+
+void
+adw_instance_stats_init (void)
+{
+  static gboolean initialized = FALSE;
+
+  if (initialized)
+    return;
+
+  initialized = TRUE;
+
+  if (!check_enabled ()) {
+    g_warning ("ADW_DEBUG_INSTANCES needs GOBJECT_DEBUG=instance-count to be set");
+
+    return;
+  }
+
+  atexit (print_stats);
+}
+
+gboolean
+adw_instance_stats_get_enabled (void)
+{
+  return check_enabled ();
+}
+
+/* Counts the instances of @type and its subtypes */
+gsize
+adw_instance_stats_get_size (GType  type,
+                             guint *n_instances)
+{
+  g_autofree GType *children = NULL;
+  guint n_children, i;
+  GTypeQuery query;
+  guint count;
+  gsize size;
+
+  g_type_query (type, &query);
+
+  count = MAX (g_type_get_instance_count (type), 0);
+  size = (gsize) count * query.instance_size;
+
+  children = g_type_children (type, &n_children);
+
+  for (i = 0; i < n_children; i++) {
+    guint child_count;
+
+    size += adw_instance_stats_get_size (children[i], &child_count);
+    count += child_count;
+  }
+
+  if (n_instances)
+    *n_instances = count;
+
+  return size;
+}
+
+char *
+adw_instance_stats_to_string (void)
+{
+  g_autoptr (GArray) stats = g_array_new (FALSE, FALSE, sizeof (TypeStats));
+  GString *string = g_string_new (NULL);
+  guint i;
+
+  if (!check_enabled ()) {
+    g_string_append (string, "Instance counting is disabled, set GOBJECT_DEBUG=instance-count\n");
+
+    return g_string_free (string, FALSE);
+  }
+
+  collect_stats (G_TYPE_OBJECT, stats);
+  g_array_sort (stats, compare_stats);
+
+  g_string_append_printf (string, "%-32s %10s %12s\n", "Type", "Instances", "Bytes");
+
+  for (i = 0; i < stats->len; i++) {
+    TypeStats *type_stats = &g_array_index (stats, TypeStats, i);
+
+    g_string_append_printf (string, "%-32s %10u %12" G_GSIZE_FORMAT "\n",
+                            g_type_name (type_stats->type),
+                            type_stats->n_instances,
+                            type_stats->size);
+  }
+
+  g_string_append_c (string, '\n');
+
+  /* CSS nodes are private to GTK, look them up by name */
+  append_total (string, "All widgets", GTK_TYPE_WIDGET);
+  append_total (string, "All CSS nodes", g_type_from_name ("GtkCssNode"));
+  append_total (string, "All render nodes", GSK_TYPE_RENDER_NODE);
+
+  return g_string_free (string, FALSE);
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#pragma once
+
+#if !defined(_ADWAITA_INSIDE) && !defined(ADWAITA_COMPILATION)
+#error "Only <adwaita.h> can be included directly."
+#endif
+
+#include <gtk/gtk.h>
+
+G_BEGIN_DECLS
+
+extern gboolean adw_layout_stats_enabled;
+
+void adw_layout_stats_init (void);
+
+void adw_layout_stats_count_measure  (GtkWidget *widget);
+void adw_layout_stats_count_allocate (GtkWidget *widget);
+
+#define ADW_LAYOUT_STATS_MEASURE(widget) G_STMT_START { \
+  if (G_UNLIKELY (adw_layout_stats_enabled)) \
+    adw_layout_stats_count_measure (GTK_WIDGET (widget)); \
+} G_STMT_END
+
+#define ADW_LAYOUT_STATS_ALLOCATE(widget) G_STMT_START { \
+  if (G_UNLIKELY (adw_layout_stats_enabled)) \
+    adw_layout_stats_count_allocate (GTK_WIDGET (widget)); \
+} G_STMT_END
+
+G_END_DECLS
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "config.h"
+
+#include "adw-layout-stats-private.h"
+
+/* Setting ADW_DEBUG_LAYOUT_STORMS makes libadwaita containers count how many
+ * times they are measured and allocated during each frame, and log the ones
+ * that go over a threshold, along with the path to them. Since a container
+ * that measures its children several times multiplies the count of every
+ * container below it, this points out quadratic layout behavior.
+ *
+ * The value of the variable is the threshold, the default is used if it's not
+ * a number.
+ */
+
+#define DEFAULT_THRESHOLD 10
+#define CLOCK_HANDLER_KEY "adw-layout-stats-handler"
+
+typedef struct {
+  GdkFrameClock *frame_clock;
+  guint n_measures;
+  guint n_allocates;
+} LayoutCounts;
+
+gboolean adw_layout_stats_enabled = FALSE;
+
+static guint threshold = DEFAULT_THRESHOLD;
+static GHashTable *counts;
+
+static char *
+get_widget_path (GtkWidget *widget)
+{
+  GString *path = g_string_new (G_OBJECT_TYPE_NAME (widget));
+
+  for (widget = gtk_widget_get_parent (widget);
+       widget;
+       widget = gtk_widget_get_parent (widget)) {
+    g_string_prepend (path, " > ");
+    g_string_prepend (path, G_OBJECT_TYPE_NAME (widget));
+  }
+
+  return g_string_free (path, FALSE);
+}
+
+static void
+widget_finalized_cb (gpointer  data,
+                     GObject  *widget)
+{
+  g_hash_table_remove (counts, widget);
+}
+
+static void
+report_and_reset (GdkFrameClock *frame_clock)
+{
+  GHashTableIter iter;
+  GtkWidget *widget;
+  LayoutCounts *widget_counts;
+
+  g_hash_table_iter_init (&iter, counts);
+
+  while (g_hash_table_iter_next (&iter, (gpointer *) &widget, (gpointer *) &widget_counts)) {
+    if (widget_counts->frame_clock != frame_clock)
+      continue;
+
+    if (widget_counts->n_measures > threshold ||
+        widget_counts->n_allocates > threshold) {
+      g_autofree char *path = get_widget_path (widget);
+
+      g_message ("%s was measured %u times and allocated %u times in one frame",
+                 path, widget_counts->n_measures, widget_counts->n_allocates);
+    }
+
+    g_object_weak_unref (G_OBJECT (widget), widget_finalized_cb, NULL);
+    g_hash_table_iter_remove (&iter);
+  }
+}
+
+static LayoutCounts *
+get_counts (GtkWidget *widget)
+{
+  GdkFrameClock *frame_clock;
+  LayoutCounts *widget_counts;
+
+  /* Only layout that is part of a frame is interesting */
+  frame_clock = gtk_widget_get_frame_clock (widget);
+
+  if (!frame_clock)
+    return NULL;
+
+  widget_counts = g_hash_table_lookup (counts, widget);
+
+  if (widget_counts)
+    return widget_counts;
+
+  if (!g_object_get_data (G_OBJECT (frame_clock), CLOCK_HANDLER_KEY)) {
+    g_signal_connect (frame_clock, "after-paint",
+                      G_CALLBACK (report_and_reset), NULL);
+    g_object_set_data (G_OBJECT (frame_clock), CLOCK_HANDLER_KEY,
+                       GINT_TO_POINTER (TRUE));
+  }
+
+  widget_counts = g_new0 (LayoutCounts, 1);
+  widget_counts->frame_clock = frame_clock;
+
+  g_object_weak_ref (G_OBJECT (widget), widget_finalized_cb, NULL);
+  g_hash_table_insert (counts, widget, widget_counts);
+
+  return widget_counts;
+}
+
+void
+adw_layout_stats_init (void)
+{
+  const char *value = g_getenv ("ADW_DEBUG_LAYOUT_STORMS");
+  guint64 parsed;
+
+  if (!value || adw_layout_stats_enabled)
+    return;
+
+  if (g_ascii_string_to_unsigned (value, 10, 1, G_MAXUINT, &parsed, NULL))
+    threshold = (guint) parsed;
+
+  counts = g_hash_table_new_full (NULL, NULL, NULL, g_free);
+  adw_layout_stats_enabled = TRUE;
+}
+
+void
+adw_layout_stats_count_measure (GtkWidget *widget)
+{
+  LayoutCounts *widget_counts = get_counts (widget);
+
+  if (widget_counts)
+    widget_counts->n_measures++;
+}
+
+void
+adw_layout_stats_count_allocate (GtkWidget *widget)
+{
+  LayoutCounts *widget_counts = get_counts (widget);
+
+  if (widget_counts)
+    widget_counts->n_allocates++;
+}
@@ -10,6 +10,8 @@
 #include "gtkprogresstrackerprivate.h"
 #include "adw-animation-private.h"
 #include "adw-enums-private.h"
+#include "adw-frame-clock-private.h"
+#include "adw-layout-stats-private.h"
 #include "adw-leaflet.h"
 #include "adw-shadow-helper-private.h"
 #include "adw-swipeable.h"
@@ -80,6 +82,7 @@ enum {
   PROP_CAN_SWIPE_BACK,
   PROP_CAN_SWIPE_FORWARD,
   PROP_CAN_UNFOLD,
+  PROP_UNLOAD_PAGES,
   PROP_PAGES,
 
   /* orientable */
@@ -87,6 +90,11 @@ enum {
   LAST_PROP = PROP_ORIENTATION,
 };
 
+enum {
+  SIGNAL_RESTORE_PAGE,
+  SIGNAL_LAST_SIGNAL,
+};
+
 #define ADW_FOLD_UNFOLDED FALSE
 #define ADW_FOLD_FOLDED TRUE
 #define ADW_FOLD_MAX 2
@@ -96,10 +104,19 @@ enum {
 struct _AdwLeafletPage {
   GObject parent_instance;
 
+  /* The leaflet the page belongs to, the widget is NULL while the page is
+   * unloaded. */
+  AdwLeaflet *leaflet;
   GtkWidget *widget;
   char *name;
   gboolean navigatable;
 
+  /* Index of the page in the leaflet and the closest navigatable pages
+   * before and after it, kept up to date by the leaflet. */
+  guint position;
+  AdwLeafletPage *prev_navigatable;
+  AdwLeafletPage *next_navigatable;
+
   /* Convenience storage for per-child temporary frequently computed values. */
   GtkAllocation alloc;
   GtkRequisition min;
@@ -123,12 +140,9 @@ static GParamSpec *page_props[LAST_PAGE_PROP];
 struct _AdwLeaflet {
   GtkWidget parent_instance;
 
-  GList *children;
-  /* It is probably cheaper to store and maintain a reversed copy of the
-   * children list that to reverse the list every time we need to allocate or
-   * draw children for RTL languages on a horizontal widget.
-   */
-  GList *children_reversed;
+  GPtrArray *children;
+  GHashTable *widget_pages;
+  GHashTable *name_pages;
   AdwLeafletPage *visible_child;
   AdwLeafletPage *last_visible_child;
 
@@ -183,11 +197,26 @@ struct _AdwLeaflet {
 
   AdwShadowHelper *shadow_helper;
   gboolean can_unfold;
+  gboolean unload_pages;
 
   GtkSelectionModel *pages;
+
+  /* Children sizes measured at the start of a transition, reused until it
+   * finishes instead of remeasuring every child on each frame. */
+  gboolean requisitions_cached;
+  struct {
+    gboolean valid;
+    int visible_children;
+    int max_min;
+    int max_nat;
+    int sum_nat;
+    int visible_min;
+    int last_visible_min;
+  } measure_cache[GTK_ORIENTATION_MAX];
 };
 
 static GParamSpec *props[LAST_PROP];
+static guint signals[SIGNAL_LAST_SIGNAL];
 
 static int HOMOGENEOUS_PROP[ADW_FOLD_MAX][GTK_ORIENTATION_MAX] = {
   { PROP_HHOMOGENEOUS_UNFOLDED, PROP_VHOMOGENEOUS_UNFOLDED},
@@ -196,6 +225,9 @@ static int HOMOGENEOUS_PROP[ADW_FOLD_MAX][GTK_ORIENTATION_MAX] = {
 
 static void adw_leaflet_buildable_init (GtkBuildableIface *iface);
 static void adw_leaflet_swipeable_init (AdwSwipeableInterface *iface);
+static void leaflet_child_visibility_notify_cb (GObject    *obj,
+                                                GParamSpec *pspec,
+                                                gpointer    user_data);
 
 G_DEFINE_TYPE_WITH_CODE (AdwLeaflet, adw_leaflet, GTK_TYPE_WIDGET,
                          G_IMPLEMENT_INTERFACE (GTK_TYPE_ORIENTABLE, NULL)
@@ -333,6 +365,16 @@ adw_leaflet_page_init (AdwLeafletPage *self)
   self->navigatable = TRUE;
 }
 
+static inline AdwLeafletPage *
+get_nth_page (AdwLeaflet *self,
+              guint       position)
+{
+  if (position >= self->children->len)
+    return NULL;
+
+  return g_ptr_array_index (self->children, position);
+}
+
 #define ADW_TYPE_LEAFLET_PAGES (adw_leaflet_pages_get_type ())
 
 G_DECLARE_FINAL_TYPE (AdwLeafletPages, adw_leaflet_pages, ADW, LEAFLET_PAGES, GObject)
@@ -354,7 +396,7 @@ adw_leaflet_pages_get_n_items (GListModel *model)
 {
   AdwLeafletPages *self = ADW_LEAFLET_PAGES (model);
 
-  return g_list_length (self->leaflet->children);
+  return self->leaflet->children->len;
 }
 
 static gpointer
@@ -364,7 +406,7 @@ adw_leaflet_pages_get_item (GListModel *model,
   AdwLeafletPages *self = ADW_LEAFLET_PAGES (model);
   AdwLeafletPage *page;
 
-  page = g_list_nth_data (self->leaflet->children, position);
+  page = get_nth_page (self->leaflet, position);
 
   if (!page)
     return NULL;
@@ -387,7 +429,7 @@ adw_leaflet_pages_is_selected (GtkSelectionModel *model,
   AdwLeafletPages *self = ADW_LEAFLET_PAGES (model);
   AdwLeafletPage *page;
 
-  page = g_list_nth_data (self->leaflet->children, position);
+  page = get_nth_page (self->leaflet, position);
 
   return page && page == self->leaflet->visible_child;
 }
@@ -400,9 +442,11 @@ adw_leaflet_pages_select_item (GtkSelectionModel *model,
   AdwLeafletPages *self = ADW_LEAFLET_PAGES (model);
   AdwLeafletPage *page;
 
-  page = g_list_nth_data (self->leaflet->children, position);
+  page = get_nth_page (self->leaflet, position);
 
-  adw_leaflet_set_visible_child (self->leaflet, page->widget);
+  set_visible_child (self->leaflet, page,
+                     self->leaflet->transition_type,
+                     self->leaflet->child_transition.duration);
 
   return TRUE;
 }
@@ -443,62 +487,200 @@ static AdwLeafletPage *
 find_page_for_widget (AdwLeaflet *self,
                       GtkWidget  *widget)
 {
-  AdwLeafletPage *page;
-  GList *l;
-
-  for (l = self->children; l; l = l->next) {
-    page = l->data;
-
-    if (page->widget == widget)
-      return page;
-  }
+  if (!widget)
+    return NULL;
 
-  return NULL;
+  return g_hash_table_lookup (self->widget_pages, widget);
 }
 
 static AdwLeafletPage *
 find_page_for_name (AdwLeaflet *self,
                     const char *name)
 {
-  AdwLeafletPage *page;
-  GList *l;
+  AdwLeafletPage *result = NULL;
+  GPtrArray *pages;
+  guint i;
+
+  if (!name)
+    return NULL;
+
+  pages = g_hash_table_lookup (self->name_pages, name);
 
-  for (l = self->children; l; l = l->next) {
-    page = l->data;
+  if (!pages)
+    return NULL;
+
+  /* With duplicate names, the first page wins */
+  for (i = 0; i < pages->len; i++) {
+    AdwLeafletPage *page = g_ptr_array_index (pages, i);
 
-    if (g_strcmp0 (page->name, name) == 0)
-      return page;
+    if (!result || page->position < result->position)
+      result = page;
   }
 
-  return NULL;
+  return result;
 }
 
 static AdwLeafletPage *
 find_swipeable_page (AdwLeaflet             *self,
                      AdwNavigationDirection  direction)
 {
-  AdwLeafletPage *page = NULL;
-  GList *l;
+  if (!self->visible_child)
+    return NULL;
+
+  if (direction == ADW_NAVIGATION_DIRECTION_BACK)
+    return self->visible_child->prev_navigatable;
+
+  return self->visible_child->next_navigatable;
+}
+
+static void
+update_page_positions (AdwLeaflet *self,
+                       guint       from,
+                       guint       to)
+{
+  guint i;
 
-  l = g_list_find (self->children, self->visible_child);
-  do {
-    l = (direction == ADW_NAVIGATION_DIRECTION_BACK) ? l->prev : l->next;
+  for (i = from; i < to; i++) {
+    AdwLeafletPage *page = g_ptr_array_index (self->children, i);
+
+    page->position = i;
+  }
+}
 
-    if (!l)
+/* Must be called after @page has been added at its position */
+static void
+link_navigatable_neighbours (AdwLeaflet     *self,
+                             AdwLeafletPage *page)
+{
+  AdwLeafletPage *prev = NULL, *next = NULL;
+  guint i;
+
+  if (page->position > 0) {
+    prev = g_ptr_array_index (self->children, page->position - 1);
+
+    if (!prev->navigatable)
+      prev = prev->prev_navigatable;
+  }
+
+  if (page->position + 1 < self->children->len) {
+    next = g_ptr_array_index (self->children, page->position + 1);
+
+    if (!next->navigatable)
+      next = next->next_navigatable;
+  }
+
+  page->prev_navigatable = prev;
+  page->next_navigatable = next;
+
+  if (!page->navigatable)
+    return;
+
+  /* Only the pages up to the closest navigatable ones on both sides can
+   * point past @page */
+  for (i = page->position; i-- > 0;) {
+    AdwLeafletPage *p = g_ptr_array_index (self->children, i);
+
+    p->next_navigatable = page;
+
+    if (p->navigatable)
       break;
+  }
 
-    page = l->data;
-  } while (page && !page->navigatable);
+  for (i = page->position + 1; i < self->children->len; i++) {
+    AdwLeafletPage *p = g_ptr_array_index (self->children, i);
 
-  return page;
+    p->prev_navigatable = page;
+
+    if (p->navigatable)
+      break;
+  }
+}
+
+/* Must be called before @page is removed from its position */
+static void
+unlink_navigatable_neighbours (AdwLeaflet     *self,
+                               AdwLeafletPage *page)
+{
+  guint i;
+
+  if (!page->navigatable)
+    return;
+
+  for (i = page->position; i-- > 0;) {
+    AdwLeafletPage *p = g_ptr_array_index (self->children, i);
+
+    p->next_navigatable = page->next_navigatable;
+
+    if (p->navigatable)
+      break;
+  }
+
+  for (i = page->position + 1; i < self->children->len; i++) {
+    AdwLeafletPage *p = g_ptr_array_index (self->children, i);
+
+    p->prev_navigatable = page->prev_navigatable;
+
+    if (p->navigatable)
+      break;
+  }
+}
+
+static void
+index_page_name (AdwLeaflet     *self,
+                 AdwLeafletPage *page)
+{
+  GPtrArray *pages;
+
+  if (!page->name)
+    return;
+
+  pages = g_hash_table_lookup (self->name_pages, page->name);
+
+  if (!pages) {
+    pages = g_ptr_array_new ();
+    g_hash_table_insert (self->name_pages, g_strdup (page->name), pages);
+  }
+
+  g_ptr_array_add (pages, page);
+}
+
+static void
+unindex_page_name (AdwLeaflet     *self,
+                   AdwLeafletPage *page)
+{
+  GPtrArray *pages;
+
+  if (!page->name)
+    return;
+
+  pages = g_hash_table_lookup (self->name_pages, page->name);
+
+  if (!pages)
+    return;
+
+  g_ptr_array_remove_fast (pages, page);
+
+  if (pages->len == 0)
+    g_hash_table_remove (self->name_pages, page->name);
 }
 
-static GList *
-get_directed_children (AdwLeaflet *self)
+static inline gboolean
+is_children_reversed (AdwLeaflet *self)
 {
   return self->orientation == GTK_ORIENTATION_HORIZONTAL &&
-         gtk_widget_get_direction (GTK_WIDGET (self)) == GTK_TEXT_DIR_RTL ?
-         self->children_reversed : self->children;
+         gtk_widget_get_direction (GTK_WIDGET (self)) == GTK_TEXT_DIR_RTL;
+}
+
+/* Gets the page at @i in the order the pages are laid out in */
+static inline AdwLeafletPage *
+get_directed_page (AdwLeaflet *self,
+                   guint       i,
+                   gboolean    reversed)
+{
+  if (reversed)
+    i = self->children->len - 1 - i;
+
+  return g_ptr_array_index (self->children, i);
 }
 
 static GtkPanDirection
@@ -597,6 +779,180 @@ get_child_window_y (AdwLeaflet     *self,
   return 0;
 }
 
+static inline gboolean
+is_transition_running (AdwLeaflet *self)
+{
+  return self->mode_transition.tick_id != 0 ||
+         self->child_transition.tick_id != 0 ||
+         self->child_transition.is_gesture_active;
+}
+
+static void
+invalidate_size_cache (AdwLeaflet *self)
+{
+  self->requisitions_cached = FALSE;
+  self->measure_cache[GTK_ORIENTATION_HORIZONTAL].valid = FALSE;
+  self->measure_cache[GTK_ORIENTATION_VERTICAL].valid = FALSE;
+}
+
+static gboolean
+object_handled_accumulator (GSignalInvocationHint *ihint,
+                            GValue                *return_accu,
+                            const GValue          *handler_return,
+                            gpointer               data)
+{
+  GObject *object = g_value_get_object (handler_return);
+
+  g_value_set_object (return_accu, object);
+
+  return !object;
+}
+
+static gboolean
+can_unload_pages (AdwLeaflet *self)
+{
+  /* All pages are shown side by side when unfolded */
+  return self->unload_pages &&
+         !self->can_unfold &&
+         g_signal_has_handler_pending (self, signals[SIGNAL_RESTORE_PAGE], 0, FALSE);
+}
+
+static gboolean
+must_stay_loaded (AdwLeaflet     *self,
+                  AdwLeafletPage *page)
+{
+  AdwLeafletPage *visible_child = self->visible_child;
+
+  if (!visible_child)
+    return TRUE;
+
+  /* Keep the pages that can be swiped to */
+  return page == visible_child ||
+         page == self->last_visible_child ||
+         page == visible_child->prev_navigatable ||
+         page == visible_child->next_navigatable;
+}
+
+static void
+insert_page_widget (AdwLeaflet     *self,
+                    AdwLeafletPage *page)
+{
+  AdwLeafletPage *sibling_page = NULL;
+  guint i;
+
+  /* Skip the unloaded pages, they have no widget to insert after */
+  for (i = page->position; i-- > 0;) {
+    AdwLeafletPage *p = g_ptr_array_index (self->children, i);
+
+    if (p->widget) {
+      sibling_page = p;
+
+      break;
+    }
+  }
+
+  if (self->transition_type == ADW_LEAFLET_TRANSITION_TYPE_OVER)
+    gtk_widget_insert_before (page->widget, GTK_WIDGET (self),
+                              sibling_page ? sibling_page->widget : NULL);
+  else
+    gtk_widget_insert_after (page->widget, GTK_WIDGET (self),
+                              sibling_page ? sibling_page->widget : NULL);
+}
+
+static void
+load_page (AdwLeaflet     *self,
+           AdwLeafletPage *page)
+{
+  GtkWidget *child = NULL;
+
+  if (page->widget)
+    return;
+
+  g_signal_emit (self, signals[SIGNAL_RESTORE_PAGE], 0, page, &child);
+
+  if (!child) {
+    g_critical ("AdwLeaflet::restore-page handler must not return NULL");
+
+    return;
+  }
+
+  /* The handler returns a new reference, which may be floating */
+  if (g_object_is_floating (child))
+    g_object_ref_sink (child);
+
+  if (gtk_widget_get_parent (child)) {
+    g_critical ("AdwLeaflet::restore-page handler must return a widget without a parent");
+    g_object_unref (child);
+
+    return;
+  }
+
+  page->widget = child;
+
+  g_hash_table_insert (self->widget_pages, child, page);
+
+  gtk_widget_set_child_visible (child, FALSE);
+  insert_page_widget (self, page);
+
+  g_signal_connect (child, "notify::visible",
+                    G_CALLBACK (leaflet_child_visibility_notify_cb), self);
+
+  invalidate_size_cache (self);
+
+  g_object_notify_by_pspec (G_OBJECT (page), page_props[PAGE_PROP_CHILD]);
+}
+
+static void
+unload_page (AdwLeaflet     *self,
+             AdwLeafletPage *page)
+{
+  GtkWidget *child = page->widget;
+
+  if (!child)
+    return;
+
+  g_hash_table_remove (self->widget_pages, child);
+
+  g_signal_handlers_disconnect_by_func (child,
+                                        leaflet_child_visibility_notify_cb,
+                                        self);
+
+  if (page->last_focus) {
+    g_object_remove_weak_pointer (G_OBJECT (page->last_focus),
+                                  (gpointer *) &page->last_focus);
+    page->last_focus = NULL;
+  }
+
+  page->widget = NULL;
+
+  gtk_widget_unparent (child);
+  g_object_unref (child);
+
+  invalidate_size_cache (self);
+
+  g_object_notify_by_pspec (G_OBJECT (page), page_props[PAGE_PROP_CHILD]);
+}
+
+/* Restores the pages around the visible child and, unless a transition is
+ * still using them, releases the rest. */
+static void
+update_loaded_pages (AdwLeaflet *self)
+{
+  gboolean can_unload = can_unload_pages (self);
+  gboolean transition_pending = self->last_visible_child != NULL ||
+                                self->child_transition.is_gesture_active;
+  guint i;
+
+  for (i = 0; i < self->children->len; i++) {
+    AdwLeafletPage *page = g_ptr_array_index (self->children, i);
+
+    if (!can_unload || must_stay_loaded (self, page))
+      load_page (self, page);
+    else if (!transition_pending)
+      unload_page (self, page);
+  }
+}
+
 static void
 child_progress_updated (AdwLeaflet *self)
 {
@@ -636,6 +992,8 @@ child_progress_updated (AdwLeaflet *self)
 
     gtk_widget_queue_allocate (GTK_WIDGET (self));
     self->child_transition.swipe_direction = 0;
+
+    update_loaded_pages (self);
   }
 }
 
@@ -649,7 +1007,7 @@ child_transition_cb (GtkWidget     *widget,
 
   if (self->child_transition.first_frame_skipped) {
     gtk_progress_tracker_advance_frame (&self->child_transition.tracker,
-                                        gdk_frame_clock_get_frame_time (frame_clock));
+                                        adw_frame_clock_get_frame_time (widget));
     progress = gtk_progress_tracker_get_ease_out_cubic (&self->child_transition.tracker, FALSE);
     self->child_transition.progress =
       adw_lerp (self->child_transition.start_progress,
@@ -678,9 +1036,9 @@ schedule_child_ticks (AdwLeaflet *self)
 {
   if (self->child_transition.tick_id == 0) {
     self->child_transition.tick_id =
-      gtk_widget_add_tick_callback (GTK_WIDGET (self),
-                                    child_transition_cb,
-                                    self, NULL);
+      adw_frame_clock_add_tick_callback (GTK_WIDGET (self),
+                                         child_transition_cb,
+                                         self, NULL);
     if (!self->child_transition.is_gesture_active)
       g_object_notify_by_pspec (G_OBJECT (self), props[PROP_CHILD_TRANSITION_RUNNING]);
   }
@@ -690,7 +1048,7 @@ static void
 unschedule_child_ticks (AdwLeaflet *self)
 {
   if (self->child_transition.tick_id != 0) {
-    gtk_widget_remove_tick_callback (GTK_WIDGET (self), self->child_transition.tick_id);
+    adw_frame_clock_remove_tick_callback (GTK_WIDGET (self), self->child_transition.tick_id);
     self->child_transition.tick_id = 0;
     g_object_notify_by_pspec (G_OBJECT (self), props[PROP_CHILD_TRANSITION_RUNNING]);
   }
@@ -716,6 +1074,8 @@ start_child_transition (AdwLeaflet      *self,
 {
   GtkWidget *widget = GTK_WIDGET (self);
 
+  invalidate_size_cache (self);
+
   if (gtk_widget_get_mapped (widget) &&
       ((adw_get_enable_animations (widget) &&
         transition_duration != 0) ||
@@ -768,12 +1128,12 @@ set_visible_child (AdwLeaflet               *self,
 
   /* If none, pick first visible. */
   if (!page) {
-    GList *l;
+    guint i;
 
-    for (l = self->children; l; l = l->next) {
-      AdwLeafletPage *p = l->data;
+    for (i = 0; i < self->children->len; i++) {
+      AdwLeafletPage *p = g_ptr_array_index (self->children, i);
 
-      if (gtk_widget_get_visible (p->widget)) {
+      if (p->widget && gtk_widget_get_visible (p->widget)) {
         page = p;
 
         break;
@@ -784,17 +1144,21 @@ set_visible_child (AdwLeaflet               *self,
   if (page == self->visible_child)
     return;
 
+  if (page) {
+    load_page (self, page);
+
+    if (!page->widget)
+      return;
+  }
+
   if (self->pages) {
-    guint position;
-    GList *l;
-
-    for (l = self->children, position = 0; l; l = l->next, position++) {
-      AdwLeafletPage *p = l->data;
-      if (p == self->visible_child)
-        old_pos = position;
-      else if (p == page)
-        new_pos = position;
-    }
+    /* The old visible child may have just been removed */
+    if (self->visible_child &&
+        get_nth_page (self, self->visible_child->position) == self->visible_child)
+      old_pos = self->visible_child->position;
+
+    if (page)
+      new_pos = page->position;
   }
 
   root = gtk_widget_get_root (widget);
@@ -833,6 +1197,8 @@ set_visible_child (AdwLeaflet               *self,
 
   self->visible_child = page;
 
+  invalidate_size_cache (self);
+
   if (page) {
     gtk_widget_set_child_visible (page->widget, TRUE);
 
@@ -847,18 +1213,7 @@ set_visible_child (AdwLeaflet               *self,
   if (page == NULL || self->last_visible_child == NULL)
     transition_duration = 0;
   else {
-    gboolean new_first = FALSE;
-    GList *l;
-
-    for (l = self->children; l; l = l->next) {
-      if (page == l->data) {
-        new_first = TRUE;
-
-        break;
-      }
-      if (self->last_visible_child == l->data)
-        break;
-    }
+    gboolean new_first = page->position < self->last_visible_child->position;
 
     transition_direction = get_pan_direction (self, new_first);
   }
@@ -886,6 +1241,8 @@ set_visible_child (AdwLeaflet               *self,
                                              MAX (old_pos, new_pos) - MIN (old_pos, new_pos) + 1);
   }
 
+  update_loaded_pages (self);
+
   g_object_freeze_notify (G_OBJECT (self));
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_VISIBLE_CHILD]);
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_VISIBLE_CHILD_NAME]);
@@ -910,7 +1267,7 @@ mode_transition_cb (GtkWidget     *widget,
   double ease;
 
   gtk_progress_tracker_advance_frame (&self->mode_transition.tracker,
-                                      gdk_frame_clock_get_frame_time (frame_clock));
+                                      adw_frame_clock_get_frame_time (widget));
   ease = gtk_progress_tracker_get_ease_out_cubic (&self->mode_transition.tracker, FALSE);
   set_mode_transition_progress (self,
                                 self->mode_transition.source_pos + (ease * (self->mode_transition.target_pos - self->mode_transition.source_pos)));
@@ -937,6 +1294,7 @@ start_mode_transition (AdwLeaflet *self,
   /* g_object_notify_by_pspec (G_OBJECT (revealer), props[PROP_REVEAL_CHILD]); */
 
   stop_child_transition (self);
+  invalidate_size_cache (self);
 
   if (gtk_widget_get_mapped (widget) &&
       self->mode_transition.duration != 0 &&
@@ -944,7 +1302,7 @@ start_mode_transition (AdwLeaflet *self,
       self->can_unfold) {
     self->mode_transition.source_pos = self->mode_transition.current_pos;
     if (self->mode_transition.tick_id == 0)
-      self->mode_transition.tick_id = gtk_widget_add_tick_callback (widget, mode_transition_cb, self, NULL);
+      self->mode_transition.tick_id = adw_frame_clock_add_tick_callback (widget, mode_transition_cb, self, NULL);
     gtk_progress_tracker_start (&self->mode_transition.tracker,
                                 self->mode_transition.duration * 1000,
                                 0,
@@ -1031,7 +1389,8 @@ adw_leaflet_size_allocate_folded (AdwLeaflet *self,
 {
   GtkWidget *widget = GTK_WIDGET (self);
   GtkOrientation orientation = gtk_orientable_get_orientation (GTK_ORIENTABLE (widget));
-  GList *directed_children, *children;
+  gboolean reversed;
+  guint i, n_pages;
   AdwLeafletPage *page, *visible_child;
   int start_size, end_size, visible_size;
   int remaining_start_size, remaining_end_size, remaining_size;
@@ -1043,14 +1402,15 @@ adw_leaflet_size_allocate_folded (AdwLeaflet *self,
   GtkTextDirection direction;
   gboolean under;
 
-  directed_children = get_directed_children (self);
+  reversed = is_children_reversed (self);
+  n_pages = self->children->len;
   visible_child = self->visible_child;
 
   if (!visible_child)
     return;
 
-  for (children = directed_children; children; children = children->next) {
-    page = children->data;
+  for (i = 0; i < n_pages; i++) {
+    page = get_directed_page (self, i, reversed);
 
     if (!page->widget)
       continue;
@@ -1084,8 +1444,8 @@ adw_leaflet_size_allocate_folded (AdwLeaflet *self,
     /* Child transitions should be applied only when folded and when no mode
      * transition is ongoing.
      */
-    for (children = directed_children; children; children = children->next) {
-      page = children->data;
+    for (i = 0; i < n_pages; i++) {
+      page = get_directed_page (self, i, reversed);
 
       if (page != visible_child &&
           page != self->last_visible_child) {
@@ -1113,8 +1473,8 @@ adw_leaflet_size_allocate_folded (AdwLeaflet *self,
   box_homogeneous = (self->homogeneous[ADW_FOLD_UNFOLDED][GTK_ORIENTATION_HORIZONTAL] && orientation == GTK_ORIENTATION_HORIZONTAL) ||
                     (self->homogeneous[ADW_FOLD_UNFOLDED][GTK_ORIENTATION_VERTICAL] && orientation == GTK_ORIENTATION_VERTICAL);
   if (box_homogeneous) {
-    for (children = directed_children; children; children = children->next) {
-      page = children->data;
+    for (i = 0; i < n_pages; i++) {
+      page = get_directed_page (self, i, reversed);
 
       max_child_size = orientation == GTK_ORIENTATION_HORIZONTAL ?
         MAX (max_child_size, page->nat.width) :
@@ -1124,8 +1484,8 @@ adw_leaflet_size_allocate_folded (AdwLeaflet *self,
 
   /* Compute the start size. */
   start_size = 0;
-  for (children = directed_children; children; children = children->next) {
-    page = children->data;
+  for (i = 0; i < n_pages; i++) {
+    page = get_directed_page (self, i, reversed);
 
     if (page == visible_child)
       break;
@@ -1137,8 +1497,8 @@ adw_leaflet_size_allocate_folded (AdwLeaflet *self,
 
   /* Compute the end size. */
   end_size = 0;
-  for (children = g_list_last (directed_children); children; children = children->prev) {
-    page = children->data;
+  for (i = n_pages; i-- > 0;) {
+    page = get_directed_page (self, i, reversed);
 
     if (page == visible_child)
       break;
@@ -1199,8 +1559,8 @@ adw_leaflet_size_allocate_folded (AdwLeaflet *self,
   /* Allocate starting children. */
   current_pad = start_position;
 
-  for (children = directed_children; children; children = children->next) {
-    page = children->data;
+  for (i = 0; i < n_pages; i++) {
+    page = get_directed_page (self, i, reversed);
 
     if (page == visible_child)
       break;
@@ -1232,11 +1592,11 @@ adw_leaflet_size_allocate_folded (AdwLeaflet *self,
   /* Allocate ending children. */
   current_pad = end_position;
 
-  if (!children || !children->next)
+  if (i + 1 >= n_pages)
     return;
 
-  for (children = children->next; children; children = children->next) {
-    page = children->data;
+  for (i++; i < n_pages; i++) {
+    page = get_directed_page (self, i, reversed);
 
     if (orientation == GTK_ORIENTATION_HORIZONTAL) {
       page->alloc.width = box_homogeneous ?
@@ -1271,7 +1631,8 @@ adw_leaflet_size_allocate_unfolded (AdwLeaflet *self,
   GtkWidget *widget = GTK_WIDGET (self);
   GtkOrientation orientation = gtk_orientable_get_orientation (GTK_ORIENTABLE (widget));
   GtkAllocation remaining_alloc;
-  GList *directed_children, *children;
+  gboolean reversed;
+  guint i, n_pages;
   AdwLeafletPage *page, *visible_child;
   int homogeneous_size = 0, min_size, extra_size;
   int per_child_extra, n_extra_widgets;
@@ -1286,14 +1647,15 @@ adw_leaflet_size_allocate_unfolded (AdwLeaflet *self,
   if (!visible_child)
     return;
 
-  directed_children = get_directed_children (self);
+  reversed = is_children_reversed (self);
+  n_pages = self->children->len;
 
   box_homogeneous = (self->homogeneous[ADW_FOLD_UNFOLDED][GTK_ORIENTATION_HORIZONTAL] && orientation == GTK_ORIENTATION_HORIZONTAL) ||
                     (self->homogeneous[ADW_FOLD_UNFOLDED][GTK_ORIENTATION_VERTICAL] && orientation == GTK_ORIENTATION_VERTICAL);
 
   n_visible_children = n_expand_children = 0;
-  for (children = directed_children; children; children = children->next) {
-    page = children->data;
+  for (i = 0; i < n_pages; i++) {
+    page = get_directed_page (self, i, reversed);
 
     page->visible = page->widget != NULL && gtk_widget_get_visible (page->widget);
 
@@ -1325,15 +1687,15 @@ adw_leaflet_size_allocate_unfolded (AdwLeaflet *self,
   else {
     min_size = 0;
     if (orientation == GTK_ORIENTATION_HORIZONTAL) {
-      for (children = directed_children; children; children = children->next) {
-        page = children->data;
+      for (i = 0; i < n_pages; i++) {
+        page = get_directed_page (self, i, reversed);
 
         min_size += page->nat.width;
       }
     }
     else {
-      for (children = directed_children; children; children = children->next) {
-        page = children->data;
+      for (i = 0; i < n_pages; i++) {
+        page = get_directed_page (self, i, reversed);
 
         min_size += page->nat.height;
       }
@@ -1356,8 +1718,8 @@ adw_leaflet_size_allocate_unfolded (AdwLeaflet *self,
   }
 
   /* Compute children allocation */
-  for (children = directed_children; children; children = children->next) {
-    page = children->data;
+  for (i = 0; i < n_pages; i++) {
+    page = get_directed_page (self, i, reversed);
 
     if (!page->visible)
       continue;
@@ -1432,8 +1794,8 @@ adw_leaflet_size_allocate_unfolded (AdwLeaflet *self,
             (mode_transition_type == ADW_LEAFLET_TRANSITION_TYPE_UNDER && direction == GTK_TEXT_DIR_RTL);
   else
     under = mode_transition_type == ADW_LEAFLET_TRANSITION_TYPE_OVER;
-  for (children = directed_children; children; children = children->next) {
-    page = children->data;
+  for (i = 0; i < n_pages; i++) {
+    page = get_directed_page (self, i, reversed);
 
     if (page == visible_child)
       break;
@@ -1457,8 +1819,8 @@ adw_leaflet_size_allocate_unfolded (AdwLeaflet *self,
             (mode_transition_type == ADW_LEAFLET_TRANSITION_TYPE_OVER && direction == GTK_TEXT_DIR_RTL);
   else
     under = mode_transition_type == ADW_LEAFLET_TRANSITION_TYPE_UNDER;
-  for (children = g_list_last (directed_children); children; children = children->prev) {
-    page = children->data;
+  for (i = n_pages; i-- > 0;) {
+    page = get_directed_page (self, i, reversed);
 
     if (page == visible_child)
       break;
@@ -1534,6 +1896,8 @@ update_child_visible (AdwLeaflet     *self,
 {
   gboolean enabled;
 
+  invalidate_size_cache (self);
+
   enabled = gtk_widget_get_visible (page->widget);
 
   if (self->visible_child == NULL && enabled)
@@ -1584,6 +1948,7 @@ set_orientation (AdwLeaflet     *self,
     return;
 
   self->orientation = orientation;
+  invalidate_size_cache (self);
   update_tracker_orientation (self);
   gtk_widget_queue_resize (GTK_WIDGET (self));
   g_object_notify (G_OBJECT (self), "orientation");
@@ -1596,9 +1961,11 @@ begin_swipe_cb (AdwSwipeTracker        *tracker,
 {
   self->child_transition.swipe_direction = direction;
 
+  invalidate_size_cache (self);
+
   if (self->child_transition.tick_id > 0) {
-    gtk_widget_remove_tick_callback (GTK_WIDGET (self),
-                                     self->child_transition.tick_id);
+    adw_frame_clock_remove_tick_callback (GTK_WIDGET (self),
+                                          self->child_transition.tick_id);
     self->child_transition.tick_id = 0;
     self->child_transition.is_gesture_active = TRUE;
     self->child_transition.is_cancelled = FALSE;
@@ -1663,50 +2030,33 @@ add_page (AdwLeaflet     *self,
           AdwLeafletPage *page,
           AdwLeafletPage *sibling_page)
 {
-  GList *l;
+  guint position;
 
   g_return_if_fail (page->widget != NULL);
 
-  if (page->name) {
-    for (l = self->children; l; l = l->next) {
-      AdwLeafletPage *p = l->data;
-
-      if (p->name && !g_strcmp0 (p->name, page->name)) {
-        g_warning ("While adding page: duplicate child name in AdwLeaflet: %s", page->name);
-        break;
-      }
-    }
-  }
+  if (page->name && g_hash_table_contains (self->name_pages, page->name))
+    g_warning ("While adding page: duplicate child name in AdwLeaflet: %s", page->name);
 
   g_object_ref (page);
 
-  if (!sibling_page) {
-    self->children = g_list_prepend (self->children, page);
-    self->children_reversed = g_list_append (self->children_reversed, page);
-  } else {
-    int sibling_pos = g_list_index (self->children, sibling_page);
-    int length = g_list_length (self->children);
+  page->leaflet = self;
+  position = sibling_page ? sibling_page->position + 1 : 0;
 
-    self->children =
-      g_list_insert (self->children, page, sibling_pos + 1);
-    self->children_reversed =
-      g_list_insert (self->children_reversed, page, length - sibling_pos - 1);
-  }
+  g_ptr_array_insert (self->children, position, page);
+  g_hash_table_insert (self->widget_pages, page->widget, page);
+
+  update_page_positions (self, position, self->children->len);
+  link_navigatable_neighbours (self, page);
+  index_page_name (self, page);
 
   gtk_widget_set_child_visible (page->widget, FALSE);
 
-  if (self->transition_type == ADW_LEAFLET_TRANSITION_TYPE_OVER)
-    gtk_widget_insert_before (page->widget, GTK_WIDGET (self),
-                              sibling_page ? sibling_page->widget : NULL);
-  else
-    gtk_widget_insert_after (page->widget, GTK_WIDGET (self),
-                              sibling_page ? sibling_page->widget : NULL);
+  invalidate_size_cache (self);
 
-  if (self->pages) {
-    int position = g_list_index (self->children, page);
+  insert_page_widget (self, page);
 
+  if (self->pages)
     g_list_model_items_changed (G_LIST_MODEL (self->pages), position, 0, 1);
-  }
 
   g_signal_connect (page->widget, "notify::visible",
                     G_CALLBACK (leaflet_child_visibility_notify_cb), self);
@@ -1723,27 +2073,35 @@ add_page (AdwLeaflet     *self,
 }
 
 static void
-leaflet_remove (AdwLeaflet *self,
-                GtkWidget  *child,
-                gboolean    in_dispose)
+leaflet_remove (AdwLeaflet     *self,
+                AdwLeafletPage *page,
+                gboolean        in_dispose)
 {
-  AdwLeafletPage *page;
-  gboolean was_visible;
+  GtkWidget *child = page->widget;
+  gboolean was_visible = FALSE;
 
-  page = find_page_for_widget (self, child);
-  if (!page)
-    return;
+  unindex_page_name (self, page);
+  unlink_navigatable_neighbours (self, page);
+  g_ptr_array_remove_index (self->children, page->position);
 
-  self->children = g_list_remove (self->children, page);
-  self->children_reversed = g_list_remove (self->children_reversed, page);
+  update_page_positions (self, page->position, self->children->len);
 
-  g_signal_handlers_disconnect_by_func (child,
-                                        leaflet_child_visibility_notify_cb,
-                                        self);
+  invalidate_size_cache (self);
+
+  /* Unloaded pages have no child */
+  if (child) {
+    g_hash_table_remove (self->widget_pages, child);
 
-  was_visible = gtk_widget_get_visible (child);
+    g_signal_handlers_disconnect_by_func (child,
+                                          leaflet_child_visibility_notify_cb,
+                                          self);
 
-  g_clear_object (&page->widget);
+    was_visible = gtk_widget_get_visible (child);
+
+    g_clear_object (&page->widget);
+  }
+
+  page->leaflet = NULL;
 
   if (self->visible_child == page)
     {
@@ -1756,10 +2114,14 @@ leaflet_remove (AdwLeaflet *self,
   if (self->last_visible_child == page)
     self->last_visible_child = NULL;
 
-  gtk_widget_unparent (child);
+  if (child)
+    gtk_widget_unparent (child);
 
   g_object_unref (page);
 
+  if (!in_dispose)
+    update_loaded_pages (self);
+
   if (was_visible)
     gtk_widget_queue_resize (GTK_WIDGET (self));
 }
@@ -1774,43 +2136,70 @@ adw_leaflet_measure (GtkWidget      *widget,
                      int            *natural_baseline)
 {
   AdwLeaflet *self = ADW_LEAFLET (widget);
-  GList *l;
+  guint i;
   int visible_children;
   double visible_child_progress;
   int child_min, max_min, visible_min, last_visible_min;
   int child_nat, max_nat, sum_nat;
   gboolean same_orientation;
+  gboolean use_cache;
 
-  visible_children = 0;
-  child_min = max_min = visible_min = last_visible_min = 0;
-  child_nat = max_nat = sum_nat = 0;
-  for (l = self->children; l; l = l->next) {
-    AdwLeafletPage *page = l->data;
+  ADW_LAYOUT_STATS_MEASURE (widget);
 
-    if (page->widget == NULL || !gtk_widget_get_visible (page->widget))
-      continue;
+  /* Only the unconstrained size is cached, that's what's requested on every
+   * frame while the size is being interpolated */
+  use_cache = for_size < 0 && is_transition_running (self);
 
-    visible_children++;
+  if (use_cache && self->measure_cache[orientation].valid) {
+    visible_children = self->measure_cache[orientation].visible_children;
+    max_min = self->measure_cache[orientation].max_min;
+    max_nat = self->measure_cache[orientation].max_nat;
+    sum_nat = self->measure_cache[orientation].sum_nat;
+    visible_min = self->measure_cache[orientation].visible_min;
+    last_visible_min = self->measure_cache[orientation].last_visible_min;
+  } else {
+    visible_children = 0;
+    child_min = max_min = visible_min = last_visible_min = 0;
+    child_nat = max_nat = sum_nat = 0;
+    for (i = 0; i < self->children->len; i++) {
+      AdwLeafletPage *page = g_ptr_array_index (self->children, i);
 
-    gtk_widget_measure (page->widget, orientation, for_size,
-                        &child_min, &child_nat, NULL, NULL);
+      if (page->widget == NULL || !gtk_widget_get_visible (page->widget))
+        continue;
 
-    max_min = MAX (max_min, child_min);
-    max_nat = MAX (max_nat, child_nat);
-    sum_nat += child_nat;
-  }
+      visible_children++;
 
-  if (self->visible_child != NULL)
-    gtk_widget_measure (self->visible_child->widget, orientation, for_size,
-                        &visible_min, NULL, NULL, NULL);
+      gtk_widget_measure (page->widget, orientation, for_size,
+                          &child_min, &child_nat, NULL, NULL);
 
-  if (self->last_visible_child != NULL) {
-    gtk_widget_measure (self->last_visible_child->widget, orientation, for_size,
-                        &last_visible_min, NULL, NULL, NULL);
-  } else {
-    last_visible_min = visible_min;
+      max_min = MAX (max_min, child_min);
+      max_nat = MAX (max_nat, child_nat);
+      sum_nat += child_nat;
+    }
+
+    if (self->visible_child != NULL)
+      gtk_widget_measure (self->visible_child->widget, orientation, for_size,
+                          &visible_min, NULL, NULL, NULL);
+
+    if (self->last_visible_child != NULL) {
+      gtk_widget_measure (self->last_visible_child->widget, orientation, for_size,
+                          &last_visible_min, NULL, NULL, NULL);
+    } else {
+      last_visible_min = visible_min;
+    }
+
+    if (use_cache) {
+      self->measure_cache[orientation].visible_children = visible_children;
+      self->measure_cache[orientation].max_min = max_min;
+      self->measure_cache[orientation].max_nat = max_nat;
+      self->measure_cache[orientation].sum_nat = sum_nat;
+      self->measure_cache[orientation].visible_min = visible_min;
+      self->measure_cache[orientation].last_visible_min = last_visible_min;
+      self->measure_cache[orientation].valid = TRUE;
+    }
   }
 
+
   visible_child_progress = self->child_transition.interpolate_size ? self->child_transition.progress : 1.0;
 
   same_orientation = orientation == gtk_orientable_get_orientation (GTK_ORIENTABLE (self));
@@ -1928,28 +2317,38 @@ adw_leaflet_size_allocate (GtkWidget *widget,
 {
   AdwLeaflet *self = ADW_LEAFLET (widget);
   GtkOrientation orientation = gtk_orientable_get_orientation (GTK_ORIENTABLE (widget));
-  GList *directed_children, *children;
+  gboolean reversed = is_children_reversed (self);
+  guint i, n_pages = self->children->len;
   gboolean folded;
+  gboolean measure;
+
+  ADW_LAYOUT_STATS_ALLOCATE (widget);
 
-  directed_children = get_directed_children (self);
+  /* While a transition is running, the requisitions measured at its start
+   * are still valid, only the progress changes between frames. */
+  measure = !self->requisitions_cached || !is_transition_running (self);
 
   /* Prepare children information. */
-  for (children = directed_children; children; children = children->next) {
-    AdwLeafletPage *page = children->data;
+  for (i = 0; i < n_pages; i++) {
+    AdwLeafletPage *page = get_directed_page (self, i, reversed);
 
-    gtk_widget_get_preferred_size (page->widget, &page->min, &page->nat);
+    if (measure && page->widget)
+      gtk_widget_get_preferred_size (page->widget, &page->min, &page->nat);
     page->alloc.x = page->alloc.y = page->alloc.width = page->alloc.height = 0;
     page->visible = FALSE;
   }
 
+  if (measure)
+    self->requisitions_cached = is_transition_running (self);
+
   /* Check whether the children should be stacked or not. */
   if (self->can_unfold) {
     int nat_box_size = 0, nat_max_size = 0, visible_children = 0;
 
     if (orientation == GTK_ORIENTATION_HORIZONTAL) {
 
-      for (children = directed_children; children; children = children->next) {
-        AdwLeafletPage *page = children->data;
+      for (i = 0; i < n_pages; i++) {
+        AdwLeafletPage *page = get_directed_page (self, i, reversed);
 
         /* FIXME Check the child is visible. */
         if (!page->widget)
@@ -1967,8 +2366,8 @@ adw_leaflet_size_allocate (GtkWidget *widget,
       folded = visible_children > 1 && width < nat_box_size;
     }
     else {
-      for (children = directed_children; children; children = children->next) {
-        AdwLeafletPage *page = children->data;
+      for (i = 0; i < n_pages; i++) {
+        AdwLeafletPage *page = get_directed_page (self, i, reversed);
 
         /* FIXME Check the child is visible. */
         if (!page->widget)
@@ -1998,8 +2397,11 @@ adw_leaflet_size_allocate (GtkWidget *widget,
     adw_leaflet_size_allocate_unfolded (self, width, height);
 
   /* Apply visibility and allocation. */
-  for (children = directed_children; children; children = children->next) {
-    AdwLeafletPage *page = children->data;
+  for (i = 0; i < n_pages; i++) {
+    AdwLeafletPage *page = get_directed_page (self, i, reversed);
+
+    if (!page->widget)
+      continue;
 
     gtk_widget_set_child_visible (page->widget, page->visible);
 
@@ -2020,7 +2422,8 @@ adw_leaflet_snapshot (GtkWidget   *widget,
                       GtkSnapshot *snapshot)
 {
   AdwLeaflet *self = ADW_LEAFLET (widget);
-  GList *stacked_children, *l;
+  gboolean reversed;
+  guint i;
   AdwLeafletPage *overlap_child;
   gboolean is_transition;
   gboolean is_vertical;
@@ -2042,8 +2445,7 @@ adw_leaflet_snapshot (GtkWidget   *widget,
     return;
   }
 
-  stacked_children = self->transition_type == ADW_LEAFLET_TRANSITION_TYPE_UNDER ?
-                     self->children_reversed : self->children;
+  reversed = self->transition_type == ADW_LEAFLET_TRANSITION_TYPE_UNDER;
 
   is_vertical = gtk_orientable_get_orientation (GTK_ORIENTABLE (widget)) == GTK_ORIENTATION_VERTICAL;
   is_rtl = gtk_widget_get_direction (widget) == GTK_TEXT_DIR_RTL;
@@ -2076,13 +2478,14 @@ adw_leaflet_snapshot (GtkWidget   *widget,
                                                shadow_rect.width,
                                                shadow_rect.height));
 
-  for (l = stacked_children; l; l = l->next) {
-    AdwLeafletPage *page = l->data;
+  for (i = 0; i < self->children->len; i++) {
+    AdwLeafletPage *page = get_directed_page (self, i, reversed);
 
     if (page == overlap_child)
       gtk_snapshot_pop (snapshot);
 
-    gtk_widget_snapshot_child (widget, page->widget, snapshot);
+    if (page->widget)
+      gtk_widget_snapshot_child (widget, page->widget, snapshot);
   }
 
   adw_shadow_helper_snapshot (self->shadow_helper, snapshot);
@@ -2149,6 +2552,9 @@ adw_leaflet_get_property (GObject    *object,
   case PROP_CAN_UNFOLD:
     g_value_set_boolean (value, adw_leaflet_get_can_unfold (self));
     break;
+  case PROP_UNLOAD_PAGES:
+    g_value_set_boolean (value, adw_leaflet_get_unload_pages (self));
+    break;
   case PROP_PAGES:
     g_value_take_object (value, adw_leaflet_get_pages (self));
     break;
@@ -2208,6 +2614,9 @@ adw_leaflet_set_property (GObject      *object,
   case PROP_CAN_UNFOLD:
     adw_leaflet_set_can_unfold (self, g_value_get_boolean (value));
     break;
+  case PROP_UNLOAD_PAGES:
+    adw_leaflet_set_unload_pages (self, g_value_get_boolean (value));
+    break;
   case PROP_ORIENTATION:
     set_orientation (self, g_value_get_enum (value));
     break;
@@ -2220,14 +2629,18 @@ static void
 adw_leaflet_dispose (GObject *object)
 {
   AdwLeaflet *self = ADW_LEAFLET (object);
-  GtkWidget *child;
 
   if (self->pages)
     g_list_model_items_changed (G_LIST_MODEL (self->pages), 0,
-                                g_list_length (self->children), 0);
+                                self->children->len, 0);
 
-  while ((child = gtk_widget_get_first_child (GTK_WIDGET (self))))
-    leaflet_remove (self, child, TRUE);
+  /* Go through the pages rather than the children, as other children such as
+   * the shadow aren't pages, and unloaded pages have no widget. Removing from
+   * the end doesn't need to move the other pages. */
+  while (self->children->len > 0)
+    leaflet_remove (self,
+                    g_ptr_array_index (self->children, self->children->len - 1),
+                    TRUE);
 
   g_clear_object (&self->shadow_helper);
 
@@ -2247,6 +2660,10 @@ adw_leaflet_finalize (GObject *object)
 
   unschedule_child_ticks (self);
 
+  g_clear_pointer (&self->children, g_ptr_array_unref);
+  g_clear_pointer (&self->widget_pages, g_hash_table_unref);
+  g_clear_pointer (&self->name_pages, g_hash_table_unref);
+
   G_OBJECT_CLASS (adw_leaflet_parent_class)->finalize (object);
 }
 
@@ -2502,6 +2919,31 @@ adw_leaflet_class_init (AdwLeafletClass *klass)
                             TRUE,
                             G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * AdwLeaflet:unload-pages: (attributes org.gtk.Property.get=adw_leaflet_get_unload_pages org.gtk.Property.set=adw_leaflet_set_unload_pages)
+   *
+   * Whether the children of distant pages can be released.
+   *
+   * If `TRUE`, only the visible child and the navigatable pages directly
+   * before and after it are kept, the children of the other pages are
+   * released once the leaflet isn't transitioning to or from them. Their
+   * pages stay in the leaflet with a `NULL` [property@Adw.LeafletPage:child],
+   * and the children are created again with
+   * [signal@Adw.Leaflet::restore-page] when the pages are navigated to. Use
+   * [method@Adw.Leaflet.remove_page] to remove such pages.
+   *
+   * This only has an effect when [property@Adw.Leaflet:can-unfold] is `FALSE`
+   * and [signal@Adw.Leaflet::restore-page] is handled.
+   *
+   * Since: 1.0
+   */
+  props[PROP_UNLOAD_PAGES] =
+      g_param_spec_boolean ("unload-pages",
+                            "Unload pages",
+                            "Whether the children of distant pages can be released",
+                            FALSE,
+                            G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   /**
    * AdwLeaflet:pages: (attributes org.gtk.Property.get=adw_leaflet_get_pages)
    *
@@ -2522,6 +2964,33 @@ adw_leaflet_class_init (AdwLeafletClass *klass)
 
   g_object_class_install_properties (object_class, LAST_PROP, props);
 
+  /**
+   * AdwLeaflet::restore-page:
+   * @self: a `AdwLeaflet`
+   * @page: the page to restore
+   *
+   * Emitted when the child of an unloaded page is needed again.
+   *
+   * The handler is expected to create a new child for @page, for example
+   * from its [property@Adw.LeafletPage:name], and return it.
+   *
+   * See [property@Adw.Leaflet:unload-pages].
+   *
+   * Returns: (transfer full): the new child for @page
+   *
+   * Since: 1.0
+   */
+  signals[SIGNAL_RESTORE_PAGE] =
+    g_signal_new ("restore-page",
+                  G_TYPE_FROM_CLASS (klass),
+                  G_SIGNAL_RUN_LAST,
+                  0,
+                  object_handled_accumulator,
+                  NULL, NULL,
+                  GTK_TYPE_WIDGET,
+                  1,
+                  ADW_TYPE_LEAFLET_PAGE);
+
   gtk_widget_class_set_css_name (widget_class, "leaflet");
 }
 
@@ -2533,8 +3002,10 @@ adw_leaflet_init (AdwLeaflet *self)
 
   gtk_widget_set_overflow (GTK_WIDGET (self), GTK_OVERFLOW_HIDDEN);
 
-  self->children = NULL;
-  self->children_reversed = NULL;
+  self->children = g_ptr_array_new ();
+  self->widget_pages = g_hash_table_new (NULL, NULL);
+  self->name_pages = g_hash_table_new_full (g_str_hash, g_str_equal, g_free,
+                                            (GDestroyNotify) g_ptr_array_unref);
   self->visible_child = NULL;
   self->folded = FALSE;
   self->homogeneous[ADW_FOLD_UNFOLDED][GTK_ORIENTATION_HORIZONTAL] = FALSE;
@@ -2571,7 +3042,7 @@ adw_leaflet_buildable_add_child (GtkBuildable *buildable,
 
   if (ADW_IS_LEAFLET_PAGE (child))
     add_page (self, ADW_LEAFLET_PAGE (child),
-              self->children ? g_list_last (self->children)->data : NULL);
+              get_nth_page (self, self->children->len - 1));
   else if (GTK_IS_WIDGET (child))
     adw_leaflet_append (self, GTK_WIDGET (child));
   else
@@ -2655,22 +3126,15 @@ static double
 adw_leaflet_get_progress (AdwSwipeable *swipeable)
 {
   AdwLeaflet *self = ADW_LEAFLET (swipeable);
-  gboolean new_first = FALSE;
-  GList *children;
+  gboolean new_first;
 
   if (!self->child_transition.is_gesture_active &&
       gtk_progress_tracker_get_state (&self->child_transition.tracker) == GTK_PROGRESS_STATE_AFTER)
     return 0;
 
-  for (children = self->children; children; children = children->next) {
-    if (self->last_visible_child == children->data) {
-      new_first = TRUE;
-
-      break;
-    }
-    if (self->visible_child == children->data)
-      break;
-  }
+  new_first = self->last_visible_child &&
+              (!self->visible_child ||
+               self->last_visible_child->position < self->visible_child->position);
 
   return self->child_transition.progress * (new_first ? 1 : -1);
 }
@@ -2748,7 +3212,11 @@ adw_leaflet_swipeable_init (AdwSwipeableInterface *iface)
  *
  * Gets the leaflet child th which @self belongs.
  *
- * Returns: (transfer none): the child to which @self belongs
+ * If the child has been released, this returns `NULL`, see
+ * [property@Adw.Leaflet:unload-pages]. The child is restored when the page is
+ * navigated to.
+ *
+ * Returns: (transfer none) (nullable): the child to which @self belongs
  *
  * Since: 1.0
  */
@@ -2791,36 +3259,31 @@ void
 adw_leaflet_page_set_name (AdwLeafletPage *self,
                            const char     *name)
 {
-  AdwLeaflet *leaflet = NULL;
+  AdwLeaflet *leaflet;
 
   g_return_if_fail (ADW_IS_LEAFLET_PAGE (self));
 
-  if (self->widget &&
-    gtk_widget_get_parent (self->widget) &&
-    ADW_IS_LEAFLET (gtk_widget_get_parent (self->widget))) {
-    GList *l;
-
-    leaflet = ADW_LEAFLET (gtk_widget_get_parent (self->widget));
+  leaflet = self->leaflet;
 
-    for (l = leaflet->children; l; l = l->next) {
-      AdwLeafletPage *page = l->data;
+  if (leaflet) {
+    AdwLeafletPage *page = find_page_for_name (leaflet, name);
 
-      if (self == page)
-        continue;
-
-      if (g_strcmp0 (page->name, name) == 0)
-        {
-          g_warning ("Duplicate child name in AdwLeaflet: %s", name);
-          break;
-        }
-    }
+    if (page && page != self)
+      g_warning ("Duplicate child name in AdwLeaflet: %s", name);
   }
 
   if (name == self->name)
     return;
 
+  if (leaflet)
+    unindex_page_name (leaflet, self);
+
   g_free (self->name);
   self->name = g_strdup (name);
+
+  if (leaflet)
+    index_page_name (leaflet, self);
+
   g_object_notify_by_pspec (G_OBJECT (self), page_props[PAGE_PROP_NAME]);
 
   if (leaflet && leaflet->visible_child == self)
@@ -2865,14 +3328,22 @@ adw_leaflet_page_set_navigatable (AdwLeafletPage *self,
   if (navigatable == self->navigatable)
     return;
 
+  if (self->leaflet && !navigatable)
+    unlink_navigatable_neighbours (self->leaflet, self);
+
   self->navigatable = navigatable;
 
-  if (self->widget && gtk_widget_get_parent (self->widget)) {
-    AdwLeaflet *leaflet = ADW_LEAFLET (gtk_widget_get_parent (self->widget));
+  if (self->leaflet) {
+    AdwLeaflet *leaflet = self->leaflet;
+
+    if (navigatable)
+      link_navigatable_neighbours (leaflet, self);
 
     if (self == leaflet->visible_child)
       set_visible_child (leaflet, NULL, leaflet->transition_type,
                          leaflet->child_transition.duration);
+    else
+      update_loaded_pages (leaflet);
   }
 
   g_object_notify_by_pspec (G_OBJECT (self), page_props[PAGE_PROP_NAVIGATABLE]);
@@ -2908,18 +3379,21 @@ AdwLeafletPage *
 adw_leaflet_append (AdwLeaflet *self,
                     GtkWidget  *child)
 {
-  GtkWidget *sibling;
+  AdwLeafletPage *page;
 
   g_return_val_if_fail (ADW_IS_LEAFLET (self), NULL);
   g_return_val_if_fail (GTK_IS_WIDGET (child), NULL);
   g_return_val_if_fail (gtk_widget_get_parent (child) == NULL, NULL);
 
-  if (self->children)
-    sibling = adw_leaflet_page_get_child (g_list_last (self->children)->data);
-  else
-    sibling = NULL;
+  /* The last page may be unloaded, so don't go through its child */
+  page = g_object_new (ADW_TYPE_LEAFLET_PAGE, NULL);
+  page->widget = g_object_ref (child);
 
-  return adw_leaflet_insert_child_after (self, child, sibling);
+  add_page (self, page, get_nth_page (self, self->children->len - 1));
+
+  g_object_unref (page);
+
+  return page;
 }
 
 /**
@@ -3002,8 +3476,8 @@ adw_leaflet_reorder_child_after (AdwLeaflet *self,
 {
   AdwLeafletPage *child_page;
   AdwLeafletPage *sibling_page;
-  int sibling_page_pos;
-  int previous_position;
+  guint position;
+  guint previous_position;
 
   g_return_if_fail (ADW_IS_LEAFLET (self));
   g_return_if_fail (GTK_IS_WIDGET (child));
@@ -3015,37 +3489,31 @@ adw_leaflet_reorder_child_after (AdwLeaflet *self,
   if (child == sibling)
     return;
 
-  previous_position = g_list_index (self->children, child) - 1;
-
   /* Cancel a gesture if there's one in progress */
   adw_swipe_tracker_reset (self->tracker);
 
   child_page = find_page_for_widget (self, child);
-  self->children = g_list_remove (self->children, child_page);
-  self->children_reversed = g_list_remove (self->children_reversed, child_page);
-
   sibling_page = find_page_for_widget (self, sibling);
-  sibling_page_pos = g_list_index (self->children, sibling_page);
 
-  self->children =
-    g_list_insert (self->children, child_page,
-                   sibling_page_pos + 1);
-  self->children_reversed =
-    g_list_insert (self->children_reversed, child_page,
-                   g_list_length (self->children) - sibling_page_pos - 1);
+  previous_position = child_page->position;
 
-  if (self->pages) {
-    /* Copied from gtk_list_list_model_item_moved() */
-    guint position = g_list_index (self->children, child_page);
-    guint min, max;
+  position = sibling_page ? sibling_page->position + 1 : 0;
 
-    if (previous_position < 0)
-      previous_position = 0;
-    else if (position > previous_position)
-      previous_position++;
+  /* The sibling's position is taken before removing the child */
+  if (position > previous_position)
+    position--;
 
-    if (position == previous_position)
-      return;
+  unlink_navigatable_neighbours (self, child_page);
+  g_ptr_array_remove_index (self->children, previous_position);
+  g_ptr_array_insert (self->children, position, child_page);
+
+  update_page_positions (self,
+                         MIN (position, previous_position),
+                         MAX (position, previous_position) + 1);
+  link_navigatable_neighbours (self, child_page);
+
+  if (self->pages && position != previous_position) {
+    guint min, max;
 
     min = MIN (position, previous_position);
     max = MAX (position, previous_position) + 1;
@@ -3066,21 +3534,44 @@ void
 adw_leaflet_remove (AdwLeaflet *self,
                     GtkWidget  *child)
 {
-  GList *l;
+  AdwLeafletPage *page;
   guint position;
 
   g_return_if_fail (ADW_IS_LEAFLET (self));
   g_return_if_fail (GTK_IS_WIDGET (child));
   g_return_if_fail (gtk_widget_get_parent (child) == GTK_WIDGET (self));
 
-  for (l = self->children, position = 0; l; l = l->next, position++) {
-    AdwLeafletPage *page = l->data;
+  page = find_page_for_widget (self, child);
+  g_return_if_fail (page != NULL);
 
-    if (page->widget == child)
-      break;
-  }
+  adw_leaflet_remove_page (self, page);
+}
+
+/**
+ * adw_leaflet_remove_page:
+ * @self: a `AdwLeaflet`
+ * @page: the page to remove
+ *
+ * Removes @page from @self.
+ *
+ * Unlike [method@Adw.Leaflet.remove], this can also remove pages whose child
+ * has been released, see [property@Adw.Leaflet:unload-pages].
+ *
+ * Since: 1.0
+ */
+void
+adw_leaflet_remove_page (AdwLeaflet     *self,
+                         AdwLeafletPage *page)
+{
+  guint position;
+
+  g_return_if_fail (ADW_IS_LEAFLET (self));
+  g_return_if_fail (ADW_IS_LEAFLET_PAGE (page));
+  g_return_if_fail (page->leaflet == self);
+
+  position = page->position;
 
-  leaflet_remove (self, child, FALSE);
+  leaflet_remove (self, page, FALSE);
 
   if (self->pages)
     g_list_model_items_changed (G_LIST_MODEL (self->pages), position, 1, 0);
@@ -3227,7 +3718,7 @@ void
 adw_leaflet_set_transition_type (AdwLeaflet               *self,
                                  AdwLeafletTransitionType  transition)
 {
-  GList *l;
+  guint i;
 
   g_return_if_fail (ADW_IS_LEAFLET (self));
   g_return_if_fail (transition <= ADW_LEAFLET_TRANSITION_TYPE_SLIDE);
@@ -3237,8 +3728,11 @@ adw_leaflet_set_transition_type (AdwLeaflet               *self,
 
   self->transition_type = transition;
 
-  for (l = self->children; l; l = l->next) {
-    AdwLeafletPage *page = l->data;
+  for (i = 0; i < self->children->len; i++) {
+    AdwLeafletPage *page = g_ptr_array_index (self->children, i);
+
+    if (!page->widget)
+      continue;
 
     if (self->transition_type == ADW_LEAFLET_TRANSITION_TYPE_OVER)
       gtk_widget_insert_before (page->widget, GTK_WIDGET (self), NULL);
@@ -3655,7 +4149,8 @@ adw_leaflet_navigate (AdwLeaflet             *self,
  *
  * Finds the child of @self with @name.
  *
- * Returns `NULL` if there is no child with this name.
+ * Returns `NULL` if there is no child with this name, or if the child has
+ * been released, see [property@Adw.Leaflet:unload-pages].
  *
  * See [property@Adw.LeafletPage:name].
  *
@@ -3699,6 +4194,8 @@ adw_leaflet_set_can_unfold (AdwLeaflet *self,
 
   self->can_unfold = can_unfold;
 
+  update_loaded_pages (self);
+
   gtk_widget_queue_allocate (GTK_WIDGET (self));
 
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_CAN_UNFOLD]);
@@ -3749,3 +4246,48 @@ adw_leaflet_get_pages (AdwLeaflet *self)
 
   return self->pages;
 }
+
+/**
+ * adw_leaflet_set_unload_pages: (attributes org.gtk.Method.set_property=unload-pages)
+ * @self: a `AdwLeaflet`
+ * @unload_pages: whether the children of distant pages can be released
+ *
+ * Sets whether the children of distant pages can be released.
+ *
+ * Since: 1.0
+ */
+void
+adw_leaflet_set_unload_pages (AdwLeaflet *self,
+                              gboolean    unload_pages)
+{
+  g_return_if_fail (ADW_IS_LEAFLET (self));
+
+  unload_pages = !!unload_pages;
+
+  if (self->unload_pages == unload_pages)
+    return;
+
+  self->unload_pages = unload_pages;
+
+  update_loaded_pages (self);
+
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_UNLOAD_PAGES]);
+}
+
+/**
+ * adw_leaflet_get_unload_pages: (attributes org.gtk.Method.get_property=unload-pages)
+ * @self: a `AdwLeaflet`
+ *
+ * Gets whether the children of distant pages can be released.
+ *
+ * Returns: whether the children of distant pages can be released
+ *
+ * Since: 1.0
+ */
+gboolean
+adw_leaflet_get_unload_pages (AdwLeaflet *self)
+{
+  g_return_val_if_fail (ADW_IS_LEAFLET (self), FALSE);
+
+  return self->unload_pages;
+}
@@ -69,8 +69,11 @@ void            adw_leaflet_reorder_child_after (AdwLeaflet *self,
                                                   GtkWidget *sibling);
 
 ADW_AVAILABLE_IN_ALL
-void adw_leaflet_remove (AdwLeaflet *self,
-                         GtkWidget  *child);
+void adw_leaflet_remove      (AdwLeaflet     *self,
+                              GtkWidget      *child);
+ADW_AVAILABLE_IN_ALL
+void adw_leaflet_remove_page (AdwLeaflet     *self,
+                              AdwLeafletPage *page);
 
 ADW_AVAILABLE_IN_ALL
 AdwLeafletPage *adw_leaflet_get_page (AdwLeaflet *self,
@@ -157,6 +160,12 @@ ADW_AVAILABLE_IN_ALL
 void     adw_leaflet_set_can_unfold (AdwLeaflet *self,
                                      gboolean    can_unfold);
 
+ADW_AVAILABLE_IN_ALL
+gboolean adw_leaflet_get_unload_pages (AdwLeaflet *self);
+ADW_AVAILABLE_IN_ALL
+void     adw_leaflet_set_unload_pages (AdwLeaflet *self,
+                                       gboolean    unload_pages);
+
 ADW_AVAILABLE_IN_ALL
 GtkSelectionModel *adw_leaflet_get_pages (AdwLeaflet *self) G_GNUC_WARN_UNUSED_RESULT;
 
@@ -5,6 +5,9 @@
  */
 #include "config.h"
 #include "adw-main-private.h"
+#include "adw-inspector-page-private.h"
+#include "adw-instance-stats-private.h"
+#include "adw-layout-stats-private.h"
 #include <gio/gio.h>
 #include <glib/gi18n-lib.h>
 #include <gtk/gtk.h>
@@ -107,6 +110,17 @@ adw_icons_init (void)
   g_once_init_leave (&guard, 1);
 }
 
+static void
+adw_inspector_init (void)
+{
+  /* GTK may not have registered it yet, registering twice is harmless */
+  g_io_extension_point_register ("gtk-inspector-page");
+  g_io_extension_point_implement ("gtk-inspector-page",
+                                  ADW_TYPE_INSPECTOR_PAGE,
+                                  "libadwaita",
+                                  10);
+}
+
 /**
  * adw_init:
  *
@@ -135,6 +149,12 @@ adw_init (void)
 
   adw_style_init ();
   adw_icons_init ();
+  adw_inspector_init ();
+
+  if (g_getenv ("ADW_DEBUG_INSTANCES"))
+    adw_instance_stats_init ();
+
+  adw_layout_stats_init ();
 
   adw_initialized = TRUE;
 }
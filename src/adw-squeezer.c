@@ -20,6 +20,8 @@
 
 #include "gtkprogresstrackerprivate.h"
 #include "adw-animation-private.h"
+#include "adw-frame-clock-private.h"
+#include "adw-layout-stats-private.h"
 
 /**
  * AdwSqueezer:
@@ -396,7 +398,7 @@ adw_squeezer_transition_cb (GtkWidget     *widget,
 
   if (self->first_frame_skipped) {
     gtk_progress_tracker_advance_frame (&self->tracker,
-                                        gdk_frame_clock_get_frame_time (frame_clock));
+                                        adw_frame_clock_get_frame_time (widget));
   } else {
     self->first_frame_skipped = TRUE;
   }
@@ -422,7 +424,7 @@ adw_squeezer_schedule_ticks (AdwSqueezer *self)
 {
   if (self->tick_id == 0) {
     self->tick_id =
-      gtk_widget_add_tick_callback (GTK_WIDGET (self), adw_squeezer_transition_cb, self, NULL);
+      adw_frame_clock_add_tick_callback (GTK_WIDGET (self), adw_squeezer_transition_cb, self, NULL);
     g_object_notify_by_pspec (G_OBJECT (self), props[PROP_TRANSITION_RUNNING]);
   }
 }
@@ -431,7 +433,7 @@ static void
 adw_squeezer_unschedule_ticks (AdwSqueezer *self)
 {
   if (self->tick_id != 0) {
-    gtk_widget_remove_tick_callback (GTK_WIDGET (self), self->tick_id);
+    adw_frame_clock_remove_tick_callback (GTK_WIDGET (self), self->tick_id);
     self->tick_id = 0;
     g_object_notify_by_pspec (G_OBJECT (self), props[PROP_TRANSITION_RUNNING]);
   }
@@ -880,6 +882,8 @@ adw_squeezer_size_allocate (GtkWidget *widget,
   GList *l;
   GtkAllocation child_allocation;
 
+  ADW_LAYOUT_STATS_ALLOCATE (widget);
+
   for (l = self->children; l; l = l->next) {
     int for_size = -1;
 
@@ -984,6 +988,8 @@ adw_squeezer_measure (GtkWidget      *widget,
   GList *l;
   int min = 0, nat = 0;
 
+  ADW_LAYOUT_STATS_MEASURE (widget);
+
   for (l = self->children; l != NULL; l = l->next) {
     AdwSqueezerPage *page = l->data;
     GtkWidget *child = page->widget;
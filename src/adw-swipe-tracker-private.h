@@ -18,4 +18,8 @@ G_BEGIN_DECLS
 
 void adw_swipe_tracker_reset (AdwSwipeTracker *self);
 
+GSList     *adw_swipe_tracker_get_all        (void);
+const char *adw_swipe_tracker_get_state_name (AdwSwipeTracker *self);
+double      adw_swipe_tracker_get_progress   (AdwSwipeTracker *self);
+
 G_END_DECLS
@@ -108,6 +108,9 @@ enum {
 
 static GParamSpec *props[LAST_PROP];
 
+/* For the inspector */
+static GSList *swipe_tracker_list;
+
 enum {
   SIGNAL_BEGIN_SWIPE,
   SIGNAL_UPDATE_SWIPE,
@@ -808,6 +811,8 @@ adw_swipe_tracker_constructed (GObject *object)
 
   g_assert (self->swipeable);
 
+  swipe_tracker_list = g_slist_prepend (swipe_tracker_list, self);
+
   g_signal_connect_object (self->swipeable, "unrealize", G_CALLBACK (reset), self, G_CONNECT_SWAPPED);
 
   controller = gtk_event_controller_motion_new ();
@@ -857,6 +862,8 @@ adw_swipe_tracker_dispose (GObject *object)
 {
   AdwSwipeTracker *self = ADW_SWIPE_TRACKER (object);
 
+  swipe_tracker_list = g_slist_remove (swipe_tracker_list, self);
+
   if (self->touch_gesture) {
     gtk_widget_remove_controller (GTK_WIDGET (self->swipeable),
                                   GTK_EVENT_CONTROLLER (self->touch_gesture));
@@ -1377,3 +1384,38 @@ adw_swipe_tracker_reset (AdwSwipeTracker *self)
   if (self->scroll_controller)
     gtk_event_controller_reset (self->scroll_controller);
 }
+
+GSList *
+adw_swipe_tracker_get_all (void)
+{
+  return swipe_tracker_list;
+}
+
+const char *
+adw_swipe_tracker_get_state_name (AdwSwipeTracker *self)
+{
+  g_return_val_if_fail (ADW_IS_SWIPE_TRACKER (self), NULL);
+
+  switch (self->state) {
+  case ADW_SWIPE_TRACKER_STATE_NONE:
+    return "idle";
+  case ADW_SWIPE_TRACKER_STATE_PENDING:
+    return "pending";
+  case ADW_SWIPE_TRACKER_STATE_SCROLLING:
+    return "scrolling";
+  case ADW_SWIPE_TRACKER_STATE_FINISHING:
+    return "finishing";
+  case ADW_SWIPE_TRACKER_STATE_REJECTED:
+    return "rejected";
+  default:
+    g_assert_not_reached ();
+  }
+}
+
+double
+adw_swipe_tracker_get_progress (AdwSwipeTracker *self)
+{
+  g_return_val_if_fail (ADW_IS_SWIPE_TRACKER (self), 0.0);
+
+  return self->progress;
+}
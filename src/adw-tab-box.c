@@ -10,6 +10,8 @@
 
 #include "adw-tab-box-private.h"
 #include "adw-animation-private.h"
+#include "adw-frame-clock-private.h"
+#include "adw-layout-stats-private.h"
 #include "adw-tab-private.h"
 #include "adw-tab-bar-private.h"
 #include "adw-tab-view-private.h"
@@ -63,7 +65,6 @@ typedef struct {
   double end_reorder_offset;
   double reorder_offset;
 
-  AdwAnimation *reorder_animation;
   gboolean reorder_ignore_bounds;
 
   double appear_progress;
@@ -72,6 +73,12 @@ typedef struct {
   gulong notify_needs_attention_id;
 } TabInfo;
 
+typedef struct {
+  TabInfo *info;
+  double start_offset;
+  gint64 start_time;
+} ReorderOffset;
+
 struct _AdwTabBox
 {
   GtkWidget parent_instance;
@@ -131,6 +138,23 @@ struct _AdwTabBox
   DragIcon *drag_icon;
   gboolean should_detach_into_new_window;
 
+  /* Reused across drags instead of creating new tabs every time */
+  TabInfo *cached_placeholder;
+  AdwTab *cached_drag_icon_tab;
+
+  /* Tabs shifting aside for the reordered tab, all driven by one tick callback */
+  GArray *reorder_offsets;
+  guint reorder_offsets_tick_id;
+
+  /* Indexable copy of tabs for dragging, rebuilt when tabs are added or removed */
+  GPtrArray *reorder_tabs;
+  gboolean reorder_tabs_valid;
+  int reordered_tab_index;
+
+  /* Where each tab would end with a placeholder inserted, rebuilt on layout */
+  GArray *drop_slots;
+  gboolean drop_slots_valid;
+
   TabInfo *drop_target_tab;
   guint drop_switch_timeout_id;
   guint reset_drop_target_tab_id;
@@ -921,23 +945,60 @@ scroll_cb (AdwTabBox          *self,
 
 /* Reordering */
 
+static void check_end_reordering (AdwTabBox *self);
+
+static int
+find_reorder_offset (AdwTabBox *self,
+                     TabInfo   *info)
+{
+  guint i;
+
+  for (i = 0; i < self->reorder_offsets->len; i++)
+    if (g_array_index (self->reorder_offsets, ReorderOffset, i).info == info)
+      return i;
+
+  return -1;
+}
+
 static void
-force_end_reordering (AdwTabBox *self)
+stop_reorder_offsets (AdwTabBox *self)
 {
-  GList *l;
+  if (!self->reorder_offsets_tick_id)
+    return;
+
+  adw_frame_clock_remove_tick_callback (GTK_WIDGET (self), self->reorder_offsets_tick_id);
+  self->reorder_offsets_tick_id = 0;
+
+  g_array_set_size (self->reorder_offsets, 0);
 
+  check_end_reordering (self);
+}
+
+static void
+stop_reorder_offset (AdwTabBox *self,
+                     TabInfo   *info)
+{
+  int index = find_reorder_offset (self, info);
+
+  if (index < 0)
+    return;
+
+  g_array_remove_index_fast (self->reorder_offsets, index);
+
+  if (self->reorder_offsets->len == 0)
+    stop_reorder_offsets (self);
+}
+
+static void
+force_end_reordering (AdwTabBox *self)
+{
   if (self->dragging || !self->reordered_tab)
     return;
 
   if (self->reorder_animation)
     adw_animation_stop (self->reorder_animation);
 
-  for (l = self->tabs; l; l = l->next) {
-    TabInfo *info = l->data;
-
-    if (info->reorder_animation)
-      adw_animation_stop (info->reorder_animation);
-  }
+  stop_reorder_offsets (self);
 }
 
 static void
@@ -948,16 +1009,9 @@ check_end_reordering (AdwTabBox *self)
   if (self->dragging || !self->reordered_tab || self->continue_reorder)
     return;
 
-  if (self->reorder_animation)
+  if (self->reorder_animation || self->reorder_offsets_tick_id)
     return;
 
-  for (l = self->tabs; l; l = l->next) {
-    TabInfo *info = l->data;
-
-    if (info->reorder_animation)
-      return;
-  }
-
   for (l = self->tabs; l; l = l->next) {
     TabInfo *info = l->data;
 
@@ -969,6 +1023,7 @@ check_end_reordering (AdwTabBox *self)
 
   self->tabs = g_list_remove (self->tabs, self->reordered_tab);
   self->tabs = g_list_insert (self->tabs, self->reordered_tab, self->reorder_index);
+  self->reorder_tabs_valid = FALSE;
 
   gtk_widget_queue_allocate (GTK_WIDGET (self));
 
@@ -980,6 +1035,7 @@ start_reordering (AdwTabBox *self,
                   TabInfo   *info)
 {
   self->reordered_tab = info;
+  self->reorder_tabs_valid = FALSE;
 
   /* The reordered tab should be displayed above everything else */
   gtk_widget_insert_before (GTK_WIDGET (self->reordered_tab->tab),
@@ -1053,26 +1109,42 @@ animate_reordering (AdwTabBox *self,
   check_end_reordering (self);
 }
 
-static void
-reorder_offset_animation_value_cb (double   value,
-                                   gpointer user_data)
+static gboolean
+reorder_offsets_tick_cb (GtkWidget     *widget,
+                         GdkFrameClock *frame_clock,
+                         gpointer       user_data)
 {
-  TabInfo *info = user_data;
-  GtkWidget *parent = gtk_widget_get_parent (GTK_WIDGET (info->tab));
+  AdwTabBox *self = ADW_TAB_BOX (widget);
+  gint64 frame_time = adw_frame_clock_get_frame_time (widget) / 1000;
+  guint i = 0;
 
-  info->reorder_offset = value;
-  gtk_widget_queue_allocate (parent);
-}
+  while (i < self->reorder_offsets->len) {
+    ReorderOffset *offset = &g_array_index (self->reorder_offsets, ReorderOffset, i);
+    TabInfo *info = offset->info;
+    double t = (double) (frame_time - offset->start_time) / REORDER_ANIMATION_DURATION;
 
-static void
-reorder_offset_animation_done_cb (gpointer user_data)
-{
-  TabInfo *info = user_data;
-  GtkWidget *parent = gtk_widget_get_parent (GTK_WIDGET (info->tab));
-  AdwTabBox *self = ADW_TAB_BOX (parent);
+    if (t >= 1) {
+      info->reorder_offset = info->end_reorder_offset;
+      g_array_remove_index_fast (self->reorder_offsets, i);
+
+      continue;
+    }
+
+    info->reorder_offset = adw_lerp (offset->start_offset,
+                                     info->end_reorder_offset,
+                                     adw_ease_out_cubic (t));
+    i++;
+  }
+
+  gtk_widget_queue_allocate (widget);
+
+  if (self->reorder_offsets->len > 0)
+    return G_SOURCE_CONTINUE;
 
-  g_clear_pointer (&info->reorder_animation, adw_animation_unref);
+  self->reorder_offsets_tick_id = 0;
   check_end_reordering (self);
+
+  return G_SOURCE_REMOVE;
 }
 
 static void
@@ -1081,6 +1153,8 @@ animate_reorder_offset (AdwTabBox *self,
                         double     offset)
 {
   gboolean is_rtl = gtk_widget_get_direction (GTK_WIDGET (self)) == GTK_TEXT_DIR_RTL;
+  ReorderOffset *reorder_offset;
+  int index;
 
   offset *= (is_rtl ? -1 : 1);
 
@@ -1089,18 +1163,35 @@ animate_reorder_offset (AdwTabBox *self,
 
   info->end_reorder_offset = offset;
 
-  if (info->reorder_animation)
-    adw_animation_stop (info->reorder_animation);
+  if (!adw_get_enable_animations (GTK_WIDGET (self)) ||
+      !gtk_widget_get_mapped (GTK_WIDGET (self))) {
+    stop_reorder_offset (self, info);
 
-  info->reorder_animation =
-    adw_animation_new (GTK_WIDGET (self), info->reorder_offset, offset,
-                       REORDER_ANIMATION_DURATION,
-                       adw_ease_out_cubic,
-                       reorder_offset_animation_value_cb,
-                       reorder_offset_animation_done_cb,
-                       info);
+    info->reorder_offset = offset;
+    gtk_widget_queue_allocate (GTK_WIDGET (self));
+    check_end_reordering (self);
+
+    return;
+  }
+
+  /* Retargeting restarts the tab's timeline from where it is now */
+  index = find_reorder_offset (self, info);
+
+  if (index < 0) {
+    g_array_set_size (self->reorder_offsets, self->reorder_offsets->len + 1);
+    index = self->reorder_offsets->len - 1;
+  }
 
-  adw_animation_start (info->reorder_animation);
+  reorder_offset = &g_array_index (self->reorder_offsets, ReorderOffset, index);
+  reorder_offset->info = info;
+  reorder_offset->start_offset = info->reorder_offset;
+  reorder_offset->start_time = adw_frame_clock_get_frame_time (GTK_WIDGET (self)) / 1000;
+
+  if (!self->reorder_offsets_tick_id)
+    self->reorder_offsets_tick_id =
+      adw_frame_clock_add_tick_callback (GTK_WIDGET (self),
+                                         reorder_offsets_tick_cb,
+                                         NULL, NULL);
 }
 
 static void
@@ -1200,14 +1291,60 @@ page_reordered_cb (AdwTabBox  *self,
 }
 
 static void
-update_drag_reodering (AdwTabBox *self)
+ensure_reorder_tabs (AdwTabBox *self)
 {
-  gboolean is_rtl, after_selected, found_index;
-  int x;
-  int i = 0;
-  int width;
   GList *l;
 
+  if (self->reorder_tabs_valid)
+    return;
+
+  g_ptr_array_set_size (self->reorder_tabs, 0);
+  self->reordered_tab_index = -1;
+
+  for (l = self->tabs; l; l = l->next) {
+    if (l->data == self->reordered_tab)
+      self->reordered_tab_index = self->reorder_tabs->len;
+
+    g_ptr_array_add (self->reorder_tabs, l->data);
+  }
+
+  self->reorder_tabs_valid = TRUE;
+}
+
+static inline int
+get_reorder_tab_center (AdwTabBox *self,
+                        int        index)
+{
+  TabInfo *info = g_ptr_array_index (self->reorder_tabs, index);
+
+  return info->pos - calculate_tab_offset (self, info, FALSE) + info->width / 2;
+}
+
+/* Tabs before the reordered one move aside once the reordered tab passes their
+ * center, and so do the tabs after it. Both conditions are monotonic in tab
+ * order, so the boundaries can be found with a binary search. */
+static inline gboolean
+should_move_aside (AdwTabBox *self,
+                   int        index,
+                   int        x,
+                   int        width,
+                   gboolean   is_rtl)
+{
+  int center = get_reorder_tab_center (self, index);
+  gboolean after_reordered = index > self->reordered_tab_index;
+
+  if (after_reordered != is_rtl)
+    return x + width > center;
+
+  return x < center;
+}
+
+static void
+update_drag_reodering (AdwTabBox *self)
+{
+  gboolean is_rtl, full_update;
+  int x, width, lower, upper, mid, original_index, new_index, first, last, i;
+
   if (!self->dragging)
     return;
 
@@ -1220,31 +1357,63 @@ update_drag_reodering (AdwTabBox *self)
   gtk_widget_queue_allocate (GTK_WIDGET (self));
 
   is_rtl = gtk_widget_get_direction (GTK_WIDGET (self)) == GTK_TEXT_DIR_RTL;
-  after_selected = FALSE;
-  found_index = FALSE;
 
-  for (l = self->tabs; l; l = l->next) {
-    TabInfo *info = l->data;
-    int center = info->pos - calculate_tab_offset (self, info, FALSE) + info->width / 2;
-    double offset = 0;
+  /* If tabs were added or removed, reorder_index and the tab offsets can't be
+   * trusted anymore, so recheck every tab once */
+  full_update = !self->reorder_tabs_valid;
+  ensure_reorder_tabs (self);
 
-    if (x + width > center && center > x &&
-        (!found_index || after_selected)) {
-      self->reorder_index = i;
-      found_index = TRUE;
-    }
+  original_index = self->reordered_tab_index;
 
-    i++;
+  g_assert (original_index >= 0);
 
-    if (info == self->reordered_tab) {
-      after_selected = TRUE;
-      continue;
-    }
+  /* The first tab before the reordered one that has to move aside */
+  lower = 0;
+  upper = original_index;
+  while (lower < upper) {
+    mid = (lower + upper) / 2;
+
+    if (should_move_aside (self, mid, x, width, is_rtl))
+      upper = mid;
+    else
+      lower = mid + 1;
+  }
+
+  new_index = lower;
+
+  /* The last tab after the reordered one that has to move aside */
+  lower = original_index + 1;
+  upper = self->reorder_tabs->len;
+  while (lower < upper) {
+    mid = (lower + upper) / 2;
 
-    if (after_selected != is_rtl && x + width > center)
-      offset = -1;
-    else if (after_selected == is_rtl && x < center)
-      offset = 1;
+    if (should_move_aside (self, mid, x, width, is_rtl))
+      lower = mid + 1;
+    else
+      upper = mid;
+  }
+
+  if (lower - 1 > original_index)
+    new_index = lower - 1;
+
+  if (full_update) {
+    first = 0;
+    last = self->reorder_tabs->len - 1;
+  } else {
+    first = MIN (MIN (self->reorder_index, new_index), original_index);
+    last = MAX (MAX (self->reorder_index, new_index), original_index);
+  }
+
+  self->reorder_index = new_index;
+
+  for (i = first; i <= last; i++) {
+    TabInfo *info = g_ptr_array_index (self->reorder_tabs, i);
+    double offset = 0;
+
+    if (i > original_index && i <= new_index)
+      offset = is_rtl ? 1 : -1;
+    else if (i < original_index && i >= new_index)
+      offset = is_rtl ? -1 : 1;
 
     animate_reorder_offset (self, info, offset);
   }
@@ -1286,7 +1455,7 @@ drag_autoscroll_cb (GtkWidget     *widget,
              autoscroll_area,
              self->allocated_width - tab_width - autoscroll_area);
 
-  time = gdk_frame_clock_get_frame_time (frame_clock);
+  time = adw_frame_clock_get_frame_time (widget);
   delta_ms = (time - self->drag_autoscroll_prev_time) / 1000.0;
 
   start_threshold = value + autoscroll_area;
@@ -1320,29 +1489,25 @@ drag_autoscroll_cb (GtkWidget     *widget,
 static void
 start_autoscroll (AdwTabBox *self)
 {
-  GdkFrameClock *frame_clock;
-
   if (!self->adjustment)
     return;
 
   if (self->drag_autoscroll_cb_id)
     return;
 
-  frame_clock = gtk_widget_get_frame_clock (GTK_WIDGET (self));
-
-  self->drag_autoscroll_prev_time = gdk_frame_clock_get_frame_time (frame_clock);
+  self->drag_autoscroll_prev_time = adw_frame_clock_get_frame_time (GTK_WIDGET (self));
   self->drag_autoscroll_cb_id =
-    gtk_widget_add_tick_callback (GTK_WIDGET (self),
-                                  (GtkTickCallback) drag_autoscroll_cb,
-                                  self, NULL);
+    adw_frame_clock_add_tick_callback (GTK_WIDGET (self),
+                                       (GtkTickCallback) drag_autoscroll_cb,
+                                       self, NULL);
 }
 
 static void
 end_autoscroll (AdwTabBox *self)
 {
   if (self->drag_autoscroll_cb_id) {
-    gtk_widget_remove_tick_callback (GTK_WIDGET (self),
-                                     self->drag_autoscroll_cb_id);
+    adw_frame_clock_remove_tick_callback (GTK_WIDGET (self),
+                                          self->drag_autoscroll_cb_id);
     self->drag_autoscroll_cb_id = 0;
   }
 }
@@ -1366,6 +1531,7 @@ start_drag_reodering (AdwTabBox *self,
       adw_animation_stop (self->reorder_animation);
 
     reset_reorder_animations (self);
+    self->reorder_tabs_valid = FALSE;
 
     self->reorder_x = (int) round (x - self->drag_offset_x);
     self->reorder_y = (int) round (y - self->drag_offset_y);
@@ -1681,10 +1847,14 @@ page_attached_cb (AdwTabBox  *self,
                        open_animation_done_cb,
                        info);
 
+  adw_animation_set_essential (info->appear_animation, FALSE);
+
   l = find_nth_alive_tab (self, position);
   self->tabs = g_list_insert_before (self->tabs, l, info);
+  self->reorder_tabs_valid = FALSE;
 
   self->n_tabs++;
+  self->drop_slots_valid = FALSE;
 
   adw_animation_start (info->appear_animation);
 
@@ -1706,9 +1876,9 @@ close_animation_done_cb (gpointer user_data)
   g_clear_pointer (&info->appear_animation, adw_animation_unref);
 
   self->tabs = g_list_remove (self->tabs, info);
+  self->reorder_tabs_valid = FALSE;
 
-  if (info->reorder_animation)
-    adw_animation_stop (info->reorder_animation);
+  stop_reorder_offset (self, info);
 
   if (self->reorder_animation)
     adw_animation_stop (self->reorder_animation);
@@ -1722,6 +1892,7 @@ close_animation_done_cb (gpointer user_data)
   remove_and_free_tab_info (info);
 
   self->n_tabs--;
+  self->drop_slots_valid = FALSE;
 }
 
 static void
@@ -1788,6 +1959,7 @@ page_detached_cb (AdwTabBox  *self,
                        close_animation_done_cb,
                        info);
 
+  adw_animation_set_essential (info->appear_animation, FALSE);
   adw_animation_start (info->appear_animation);
 }
 
@@ -1878,37 +2050,115 @@ adw_tab_box_root_content_new (AdwTabBox *tab_box)
   return GDK_CONTENT_PROVIDER (self);
 }
 
-static int
-calculate_placeholder_index (AdwTabBox *self,
-                             int        x)
+static void
+ensure_drop_slots (AdwTabBox *self)
 {
-  int lower, upper, pos, i;
   gboolean is_rtl;
+  int pos;
   GList *l;
 
-  get_visible_range (self, &lower, &upper);
+  if (self->drop_slots_valid)
+    return;
 
-  x = CLAMP (x, lower, upper);
+  g_array_set_size (self->drop_slots, 0);
 
   is_rtl = gtk_widget_get_direction (GTK_WIDGET (self)) == GTK_TEXT_DIR_RTL;
 
   pos = (is_rtl ? self->allocated_width + OVERLAP : -OVERLAP);
-  i = 0;
 
   for (l = self->tabs; l; l = l->next) {
     TabInfo *info = l->data;
     int tab_width = predict_tab_width (self, info, TRUE) * (is_rtl ? -1 : 1);
-
     int end = pos + tab_width + calculate_tab_offset (self, info, FALSE);
 
-    if ((x <= end && !is_rtl) || (x >= end && is_rtl))
-      break;
+    g_array_append_val (self->drop_slots, end);
 
     pos += tab_width + (is_rtl ? OVERLAP : -OVERLAP);
-    i++;
   }
 
-  return i;
+  self->drop_slots_valid = TRUE;
+}
+
+static int
+calculate_placeholder_index (AdwTabBox *self,
+                             int        x)
+{
+  int lower, upper, first, last;
+  gboolean is_rtl;
+
+  get_visible_range (self, &lower, &upper);
+
+  x = CLAMP (x, lower, upper);
+
+  is_rtl = gtk_widget_get_direction (GTK_WIDGET (self)) == GTK_TEXT_DIR_RTL;
+
+  ensure_drop_slots (self);
+
+  /* Find the first slot that ends after x */
+  first = 0;
+  last = self->drop_slots->len;
+
+  while (first < last) {
+    int mid = (first + last) / 2;
+    int end = g_array_index (self->drop_slots, int, mid);
+
+    if ((x <= end && !is_rtl) || (x >= end && is_rtl))
+      last = mid;
+    else
+      first = mid + 1;
+  }
+
+  return first;
+}
+
+static TabInfo *
+reuse_placeholder (AdwTabBox  *self,
+                   AdwTabPage *page)
+{
+  TabInfo *info = self->cached_placeholder;
+
+  if (!info)
+    return create_tab_info (self, page);
+
+  self->cached_placeholder = NULL;
+
+  info->page = page;
+  info->pos = -1;
+  info->width = -1;
+  info->last_width = 0;
+  info->end_reorder_offset = 0;
+  info->reorder_offset = 0;
+  info->appear_progress = 0;
+
+  adw_tab_set_page (info->tab, page);
+  adw_tab_set_inverted (info->tab, self->inverted);
+
+  gtk_widget_set_child_visible (GTK_WIDGET (info->tab), TRUE);
+
+  return info;
+}
+
+static void
+cache_placeholder (AdwTabBox *self,
+                   TabInfo   *info)
+{
+  if (self->cached_placeholder || find_reorder_offset (self, info) >= 0) {
+    remove_and_free_tab_info (info);
+
+    return;
+  }
+
+  adw_tab_set_page (info->tab, NULL);
+  gtk_widget_set_child_visible (GTK_WIDGET (info->tab), FALSE);
+
+  self->cached_placeholder = info;
+}
+
+static void
+clear_drag_caches (AdwTabBox *self)
+{
+  g_clear_pointer (&self->cached_placeholder, remove_and_free_tab_info);
+  g_clear_object (&self->cached_drag_icon_tab);
 }
 
 static void
@@ -1941,7 +2191,7 @@ insert_placeholder (AdwTabBox  *self,
 
     self->placeholder_page = page;
 
-    info = create_tab_info (self, page);
+    info = reuse_placeholder (self, page);
 
     gtk_widget_set_opacity (GTK_WIDGET (info->tab), 0);
 
@@ -1965,7 +2215,9 @@ insert_placeholder (AdwTabBox  *self,
     index = calculate_placeholder_index (self, pos + self->placeholder_scroll_offset);
 
     self->tabs = g_list_insert (self->tabs, info, index);
+    self->reorder_tabs_valid = FALSE;
     self->n_tabs++;
+    self->drop_slots_valid = FALSE;
 
     self->reorder_placeholder = info;
     self->reorder_index = g_list_index (self->tabs, info);
@@ -2052,20 +2304,21 @@ remove_animation_done_cb (gpointer user_data)
   if (self->reordered_tab == info) {
     force_end_reordering (self);
 
-    if (self->reorder_animation)
-      adw_animation_stop (info->reorder_animation);
-
     self->reordered_tab = NULL;
   }
 
+  stop_reorder_offset (self, info);
+
   if (self->pressed_tab == info)
     self->pressed_tab = NULL;
 
   self->tabs = g_list_remove (self->tabs, info);
+  self->reorder_tabs_valid = FALSE;
 
-  remove_and_free_tab_info (info);
+  cache_placeholder (self, info);
 
   self->n_tabs--;
+  self->drop_slots_valid = FALSE;
 
   self->reorder_placeholder = NULL;
 }
@@ -2190,8 +2443,20 @@ drag_end (AdwTabBox *self,
 
   self->detached_page = NULL;
 
-  if (self->drag_icon)
+  if (self->drag_icon) {
+    if (self->drag_icon->resize_animation)
+      adw_animation_stop (self->drag_icon->resize_animation);
+
+    g_clear_pointer (&self->drag_icon->resize_animation, adw_animation_unref);
+
+    /* Take the tab back from the drag icon so it can be reused, without
+     * keeping the page alive until the next drag */
+    gtk_drag_icon_set_child (GTK_DRAG_ICON (gtk_drag_icon_get_for_drag (drag)), NULL);
+    adw_tab_set_dragging (self->drag_icon->tab, FALSE);
+    adw_tab_set_page (self->drag_icon->tab, NULL);
+
     g_clear_pointer (&self->drag_icon, g_free);
+  }
 
   g_object_unref (drag);
 }
@@ -2244,7 +2509,10 @@ create_drag_icon (AdwTabBox *self,
   icon->width = predict_tab_width (self, self->reordered_tab, FALSE);
   icon->target_width = icon->width;
 
-  icon->tab = adw_tab_new (self->view, FALSE);
+  if (!self->cached_drag_icon_tab)
+    self->cached_drag_icon_tab = g_object_ref_sink (adw_tab_new (self->view, FALSE));
+
+  icon->tab = self->cached_drag_icon_tab;
   adw_tab_set_page (icon->tab, self->reordered_tab->page);
   adw_tab_set_dragging (icon->tab, TRUE);
   adw_tab_set_inverted (icon->tab, self->inverted);
@@ -2819,6 +3087,8 @@ adw_tab_box_measure (GtkWidget      *widget,
   AdwTabBox *self = ADW_TAB_BOX (widget);
   int min, nat;
 
+  ADW_LAYOUT_STATS_MEASURE (widget);
+
   if (self->n_tabs == 0) {
     if (minimum)
       *minimum = 0;
@@ -2899,6 +3169,10 @@ adw_tab_box_size_allocate (GtkWidget *widget,
   int pos;
   double value;
 
+  ADW_LAYOUT_STATS_ALLOCATE (widget);
+
+  self->drop_slots_valid = FALSE;
+
   adw_tab_box_measure (widget, GTK_ORIENTATION_HORIZONTAL, -1,
                        &self->allocated_width, NULL, NULL, NULL);
   self->allocated_width = MAX (self->allocated_width, width);
@@ -3041,9 +3315,10 @@ adw_tab_box_unmap (GtkWidget *widget)
   AdwTabBox *self = ADW_TAB_BOX (widget);
 
   force_end_reordering (self);
+  stop_reorder_offsets (self);
 
   if (self->drag_autoscroll_cb_id) {
-    gtk_widget_remove_tick_callback (widget, self->drag_autoscroll_cb_id);
+    adw_frame_clock_remove_tick_callback (widget, self->drag_autoscroll_cb_id);
     self->drag_autoscroll_cb_id = 0;
   }
 
@@ -3091,6 +3366,7 @@ adw_tab_box_dispose (GObject *object)
   self->tab_bar = NULL;
   adw_tab_box_set_view (self, NULL);
   adw_tab_box_set_adjustment (self, NULL);
+  clear_drag_caches (self);
 
   G_OBJECT_CLASS (adw_tab_box_parent_class)->dispose (object);
 }
@@ -3101,6 +3377,9 @@ adw_tab_box_finalize (GObject *object)
   AdwTabBox *self = (AdwTabBox *) object;
 
   g_clear_pointer (&self->extra_drag_types, g_free);
+  g_array_unref (self->drop_slots);
+  g_array_unref (self->reorder_offsets);
+  g_ptr_array_unref (self->reorder_tabs);
 
   G_OBJECT_CLASS (adw_tab_box_parent_class)->finalize (object);
 }
@@ -3301,6 +3580,9 @@ adw_tab_box_init (AdwTabBox *self)
 
   self->can_remove_placeholder = TRUE;
   self->expand_tabs = TRUE;
+  self->drop_slots = g_array_new (FALSE, FALSE, sizeof (int));
+  self->reorder_offsets = g_array_new (FALSE, FALSE, sizeof (ReorderOffset));
+  self->reorder_tabs = g_ptr_array_new ();
 
   gtk_widget_set_overflow (GTK_WIDGET (self), GTK_OVERFLOW_HIDDEN);
 
@@ -3372,10 +3654,15 @@ adw_tab_box_set_view (AdwTabBox  *self,
       self->view_drop_target = NULL;
     }
 
+    stop_reorder_offsets (self);
+
     g_list_free_full (self->tabs, (GDestroyNotify) remove_and_free_tab_info);
 
     self->tabs = NULL;
+    self->reorder_tabs_valid = FALSE;
     self->n_tabs = 0;
+
+    clear_drag_caches (self);
   }
 
   self->view = view;
@@ -3504,6 +3791,8 @@ adw_tab_box_setup_extra_drop_target (AdwTabBox     *self,
 #endif
   self->extra_drag_n_types = n_types;
 
+  g_clear_pointer (&self->cached_placeholder, remove_and_free_tab_info);
+
   for (l = self->tabs; l; l = l->next) {
     TabInfo *info = l->data;
 
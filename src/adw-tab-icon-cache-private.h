@@ -0,0 +1,25 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#pragma once
+
+#if !defined(_ADWAITA_INSIDE) && !defined(ADWAITA_COMPILATION)
+#error "Only <adwaita.h> can be included directly."
+#endif
+
+#include <gtk/gtk.h>
+
+G_BEGIN_DECLS
+
+#define ADW_TAB_ICON_SIZE 16
+
+void adw_tab_icon_cache_set_image (GtkImage *image,
+                                   GIcon    *icon);
+
+void adw_tab_icon_cache_get_stats (guint *hits,
+                                   guint *misses);
+
+G_END_DECLS
@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include "config.h"
+
+#include "adw-tab-icon-cache-private.h"
+
+/* Themed icons are already cached by GtkIconTheme, but every GtkImage loads
+ * other icons, e.g. favicons from GBytesIcon or GFileIcon, on its own. Keep
+ * one paintable, and so one texture, per distinct icon, size and scale for
+ * each display, and evict the least recently used ones past a fixed number.
+ */
+
+#define MAX_CACHED_ICONS 256
+
+#define CACHE_KEY "adw-tab-icon-cache"
+
+static guint n_hits;
+static guint n_misses;
+
+typedef struct {
+  GIcon *icon;
+  int size;
+  int scale;
+
+  GdkPaintable *paintable;
+  GList link;
+} CacheEntry;
+
+typedef struct {
+  GHashTable *entries;
+  GQueue lru; /* Most recently used first */
+} IconCache;
+
+static guint
+cache_entry_hash (gconstpointer key)
+{
+  const CacheEntry *entry = key;
+
+  return g_icon_hash ((gpointer) entry->icon) ^
+         ((guint) entry->size << 8) ^
+         (guint) entry->scale;
+}
+
+static gboolean
+cache_entry_equal (gconstpointer a,
+                   gconstpointer b)
+{
+  const CacheEntry *entry_a = a;
+  const CacheEntry *entry_b = b;
+
+  return entry_a->size == entry_b->size &&
+         entry_a->scale == entry_b->scale &&
+         g_icon_equal (entry_a->icon, entry_b->icon);
+}
+
+static void
+cache_entry_free (CacheEntry *entry)
+{
+  g_object_unref (entry->icon);
+  g_object_unref (entry->paintable);
+  g_free (entry);
+}
+
+static void
+icon_cache_free (IconCache *cache)
+{
+  g_hash_table_destroy (cache->entries);
+  g_free (cache);
+}
+
+static IconCache *
+get_icon_cache (GdkDisplay *display)
+{
+  IconCache *cache = g_object_get_data (G_OBJECT (display), CACHE_KEY);
+
+  if (cache)
+    return cache;
+
+  cache = g_new0 (IconCache, 1);
+  cache->entries = g_hash_table_new_full (cache_entry_hash,
+                                          cache_entry_equal,
+                                          (GDestroyNotify) cache_entry_free,
+                                          NULL);
+  g_queue_init (&cache->lru);
+
+  g_object_set_data_full (G_OBJECT (display), CACHE_KEY, cache,
+                          (GDestroyNotify) icon_cache_free);
+
+  return cache;
+}
+
+static GdkPaintable *
+lookup_paintable (GtkWidget *widget,
+                  GIcon     *icon)
+{
+  IconCache *cache = get_icon_cache (gtk_widget_get_display (widget));
+  CacheEntry key = { icon, ADW_TAB_ICON_SIZE, gtk_widget_get_scale_factor (widget) };
+  CacheEntry *entry;
+  GtkIconTheme *theme;
+
+  entry = g_hash_table_lookup (cache->entries, &key);
+
+  if (entry) {
+    n_hits++;
+
+    g_queue_unlink (&cache->lru, &entry->link);
+    g_queue_push_head_link (&cache->lru, &entry->link);
+
+    return entry->paintable;
+  }
+
+  n_misses++;
+
+  theme = gtk_icon_theme_get_for_display (gtk_widget_get_display (widget));
+
+  entry = g_new0 (CacheEntry, 1);
+  entry->icon = g_object_ref (icon);
+  entry->size = key.size;
+  entry->scale = key.scale;
+  entry->paintable =
+    GDK_PAINTABLE (gtk_icon_theme_lookup_by_gicon (theme, icon,
+                                                   entry->size,
+                                                   entry->scale,
+                                                   gtk_widget_get_direction (widget),
+                                                   0));
+  entry->link.data = entry;
+
+  g_hash_table_add (cache->entries, entry);
+  g_queue_push_head_link (&cache->lru, &entry->link);
+
+  /* Evicted paintables stay alive as long as some image still shows them */
+  while (cache->lru.length > MAX_CACHED_ICONS) {
+    GList *last = g_queue_pop_tail_link (&cache->lru);
+
+    g_hash_table_remove (cache->entries, last->data);
+  }
+
+  return entry->paintable;
+}
+
+/**
+ * adw_tab_icon_cache_set_image:
+ * @image: a `GtkImage`
+ * @icon: (nullable): an icon
+ *
+ * Sets @icon on @image, sharing the loaded icon with every other image
+ * showing an equal icon.
+ */
+void
+adw_tab_icon_cache_set_image (GtkImage *image,
+                              GIcon    *icon)
+{
+  g_return_if_fail (GTK_IS_IMAGE (image));
+  g_return_if_fail (G_IS_ICON (icon) || icon == NULL);
+
+  /* Themed icons go through the icon theme cache and must follow theme
+   * changes, let GtkImage handle them.
+   */
+  if (!icon || G_IS_THEMED_ICON (icon)) {
+    gtk_image_set_from_gicon (image, icon);
+
+    return;
+  }
+
+  gtk_image_set_from_paintable (image, lookup_paintable (GTK_WIDGET (image), icon));
+}
+
+void
+adw_tab_icon_cache_get_stats (guint *hits,
+                              guint *misses)
+{
+  if (hits)
+    *hits = n_hits;
+
+  if (misses)
+    *misses = n_misses;
+}
@@ -27,4 +27,10 @@ void adw_tab_view_attach_page (AdwTabView *self,
 
 AdwTabView *adw_tab_view_create_window (AdwTabView *self) G_GNUC_WARN_UNUSED_RESULT;
 
+gboolean adw_tab_page_get_updates_frozen (AdwTabPage *self);
+
+GSList *adw_tab_view_get_all             (void);
+void    adw_tab_view_get_thumbnail_stats (guint *n_thumbnails,
+                                          gsize *memory);
+
 G_END_DECLS
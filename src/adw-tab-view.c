@@ -12,9 +12,24 @@
 
 #include "adw-gizmo-private.h"
 
+#include <math.h>
+
 /* FIXME replace with groups */
 static GSList *tab_view_list;
 
+/* Thumbnails are downscaled to fit into this size */
+#define THUMBNAIL_SIZE 256
+/* Total memory used by thumbnails of all pages before the oldest ones are
+ * dropped */
+#define THUMBNAIL_MEMORY_LIMIT (64 * 1024 * 1024)
+
+/* With detach-hidden-pages, how many pages besides the selected one keep their
+ * children in the widget tree */
+#define N_ATTACHED_RECENT_PAGES 3
+
+static GQueue thumbnail_queue = G_QUEUE_INIT;
+static gsize thumbnail_memory;
+
 /**
  * AdwTabView:
  *
@@ -45,10 +60,29 @@ static GSList *tab_view_list;
  * Since: 1.0
  */
 
+/**
+ * AdwTabViewCloseSelection:
+ * @ADW_TAB_VIEW_CLOSE_SELECTION_POSITION: Select a page next to the closed
+ *   page, preferring pages opened from the same parent.
+ * @ADW_TAB_VIEW_CLOSE_SELECTION_RECENT: Select the most recently used page.
+ *
+ * Describes which page [class@Adw.TabView] selects when the selected page is
+ * closed.
+ *
+ * See [property@Adw.TabView:close-selection].
+ *
+ * Since: 1.0
+ */
+
 /**
  * AdwTabPage:
  *
  * An auxiliary class used by [class@Adw.TabView].
+ *
+ * See [property@Adw.TabView:throttle-background-updates] for coalescing the
+ * updates of pages that aren't selected, and
+ * [method@Adw.TabPage.freeze_updates] for changing several properties of any
+ * page at once.
  */
 
 struct _AdwTabPage
@@ -67,7 +101,26 @@ struct _AdwTabPage
   gboolean indicator_activatable;
   gboolean needs_attention;
 
+  GdkTexture *thumbnail;
+  GList thumbnail_link;
+  GskRenderNode *thumbnail_node;
+  graphene_rect_t thumbnail_bounds;
+  guint thumbnail_idle_id;
+
+  GList mru_link;
+
+  /* The view the page is attached to. Its child isn't necessarily in the
+   * view's stack, see detach-hidden-pages */
+  AdwTabView *view;
+
+  /* Normalized and casefolded title and tooltip, built on demand */
+  char *search_title;
+  char *search_tooltip;
+  gboolean search_keys_valid;
+
   gboolean closing;
+
+  guint updates_freeze_count;
 };
 
 G_DEFINE_TYPE (AdwTabPage, adw_tab_page, G_TYPE_OBJECT)
@@ -85,6 +138,7 @@ enum {
   PAGE_PROP_INDICATOR_ICON,
   PAGE_PROP_INDICATOR_ACTIVATABLE,
   PAGE_PROP_NEEDS_ATTENTION,
+  PAGE_PROP_THUMBNAIL,
   LAST_PAGE_PROP
 };
 
@@ -102,6 +156,12 @@ struct _AdwTabView
   AdwTabPage *selected_page;
   GIcon *default_icon;
   GMenuModel *menu_model;
+  gboolean throttle_background_updates;
+  AdwTabViewCloseSelection close_selection;
+  gboolean detach_hidden_pages;
+
+  /* Pages in most recently selected first order, linked through mru_link */
+  GQueue mru;
 
   int transfer_count;
 
@@ -122,6 +182,9 @@ enum {
   PROP_DEFAULT_ICON,
   PROP_MENU_MODEL,
   PROP_SHORTCUT_WIDGET,
+  PROP_THROTTLE_BACKGROUND_UPDATES,
+  PROP_CLOSE_SELECTION,
+  PROP_DETACH_HIDDEN_PAGES,
   PROP_PAGES,
   LAST_PROP
 };
@@ -214,12 +277,235 @@ set_page_parent (AdwTabPage *self,
   g_object_notify_by_pspec (G_OBJECT (self), props[PAGE_PROP_PARENT]);
 }
 
+static inline gsize
+get_texture_size (GdkTexture *texture)
+{
+  return (gsize) gdk_texture_get_width (texture) *
+         (gsize) gdk_texture_get_height (texture) * 4;
+}
+
+static void
+set_page_thumbnail (AdwTabPage *self,
+                    GdkTexture *thumbnail,
+                    gboolean    notify)
+{
+  if (self->thumbnail) {
+    thumbnail_memory -= get_texture_size (self->thumbnail);
+    g_queue_unlink (&thumbnail_queue, &self->thumbnail_link);
+    g_clear_object (&self->thumbnail);
+  }
+
+  if (thumbnail) {
+    self->thumbnail = g_object_ref (thumbnail);
+    thumbnail_memory += get_texture_size (thumbnail);
+    g_queue_push_head_link (&thumbnail_queue, &self->thumbnail_link);
+  }
+
+  if (notify)
+    g_object_notify_by_pspec (G_OBJECT (self), page_props[PAGE_PROP_THUMBNAIL]);
+
+  /* Drop the oldest thumbnails, but never the new one */
+  while (thumbnail &&
+         thumbnail_memory > THUMBNAIL_MEMORY_LIMIT &&
+         thumbnail_queue.tail != &self->thumbnail_link) {
+    AdwTabPage *page = thumbnail_queue.tail->data;
+
+    set_page_thumbnail (page, NULL, TRUE);
+  }
+}
+
+static gboolean
+render_thumbnail_cb (AdwTabPage *self)
+{
+  g_autoptr (GskRenderNode) node = g_steal_pointer (&self->thumbnail_node);
+  g_autoptr (GdkTexture) texture = NULL;
+  GtkNative *native = NULL;
+  GskRenderer *renderer = NULL;
+
+  self->thumbnail_idle_id = 0;
+
+  if (self->view)
+    native = gtk_widget_get_native (GTK_WIDGET (self->view));
+
+  if (native)
+    renderer = gtk_native_get_renderer (native);
+
+  if (!renderer)
+    return G_SOURCE_REMOVE;
+
+  texture = gsk_renderer_render_texture (renderer, node, &self->thumbnail_bounds);
+
+  set_page_thumbnail (self, texture, TRUE);
+
+  return G_SOURCE_REMOVE;
+}
+
+/* Only records the page's contents, as it may be about to be hidden. Rendering
+ * them into a texture is expensive, so it happens later in an idle. */
+static void
+capture_page_thumbnail (AdwTabPage *self)
+{
+  g_autoptr (GdkPaintable) paintable = NULL;
+  GskRenderNode *node;
+  GtkSnapshot *snapshot;
+  int width, height;
+  double scale;
+
+  /* Only pages that are on screen can be captured */
+  if (!self->child || !gtk_widget_get_mapped (self->child))
+    return;
+
+  width = gtk_widget_get_width (self->child);
+  height = gtk_widget_get_height (self->child);
+
+  if (width <= 0 || height <= 0)
+    return;
+
+  scale = MIN (1.0, THUMBNAIL_SIZE / (double) MAX (width, height));
+
+  paintable = gtk_widget_paintable_new (self->child);
+
+  snapshot = gtk_snapshot_new ();
+  gtk_snapshot_scale (snapshot, scale, scale);
+  gdk_paintable_snapshot (paintable, snapshot, width, height);
+  node = gtk_snapshot_free_to_node (snapshot);
+
+  if (!node)
+    return;
+
+  g_clear_pointer (&self->thumbnail_node, gsk_render_node_unref);
+  self->thumbnail_node = node;
+  graphene_rect_init (&self->thumbnail_bounds, 0, 0,
+                      ceil (width * scale), ceil (height * scale));
+
+  if (!self->thumbnail_idle_id) {
+    self->thumbnail_idle_id =
+      g_idle_add ((GSourceFunc) render_thumbnail_cb, self);
+    g_source_set_name_by_id (self->thumbnail_idle_id, "[adw] render_thumbnail_cb");
+  }
+}
+
+static char *
+make_search_key (const char *text,
+                 gboolean    is_markup)
+{
+  g_autofree char *plain = NULL;
+  g_autofree char *normalized = NULL;
+
+  if (!text || !*text)
+    return NULL;
+
+  if (is_markup && !pango_parse_markup (text, -1, 0, NULL, &plain, NULL, NULL))
+    plain = g_strdup (text);
+
+  normalized = g_utf8_normalize (plain ? plain : text, -1, G_NORMALIZE_ALL);
+
+  if (!normalized)
+    return NULL;
+
+  return g_utf8_casefold (normalized, -1);
+}
+
+static void
+ensure_search_keys (AdwTabPage *self)
+{
+  if (self->search_keys_valid)
+    return;
+
+  g_free (self->search_title);
+  g_free (self->search_tooltip);
+
+  self->search_title = make_search_key (self->title, FALSE);
+  self->search_tooltip = make_search_key (self->tooltip, TRUE);
+  self->search_keys_valid = TRUE;
+}
+
+static inline gboolean
+is_word_start (const char *text,
+               const char *p)
+{
+  gunichar prev;
+
+  if (p == text)
+    return TRUE;
+
+  prev = g_utf8_get_char (g_utf8_prev_char (p));
+
+  return !g_unichar_isalnum (prev);
+}
+
+/* Higher is better, negative means no match */
+static int
+get_match_score (const char *text,
+                 const char *query)
+{
+  const char *p, *q;
+  int gaps = 0;
+
+  if (!text)
+    return -1;
+
+  if (g_str_has_prefix (text, query))
+    return 4000;
+
+  for (p = strstr (text, query); p; p = strstr (p + 1, query))
+    if (is_word_start (text, p))
+      return 3000;
+
+  if (strstr (text, query))
+    return 2000;
+
+  /* Fuzzy match: all characters of the query in order, fewer gaps first */
+  p = text;
+  q = query;
+
+  while (*p && *q) {
+    if (g_utf8_get_char (p) == g_utf8_get_char (q))
+      q = g_utf8_next_char (q);
+    else if (q != query)
+      gaps++;
+
+    p = g_utf8_next_char (p);
+  }
+
+  if (*q)
+    return -1;
+
+  return MAX (1000 - gaps, 1);
+}
+
+typedef struct {
+  guint position;
+  gboolean in_title;
+  int score;
+} SearchResult;
+
+static int
+compare_search_results (gconstpointer a,
+                        gconstpointer b)
+{
+  const SearchResult *result_a = a;
+  const SearchResult *result_b = b;
+
+  if (result_a->in_title != result_b->in_title)
+    return result_a->in_title ? -1 : 1;
+
+  if (result_a->score != result_b->score)
+    return result_b->score - result_a->score;
+
+  return (result_a->position > result_b->position) -
+         (result_a->position < result_b->position);
+}
+
 static void
 adw_tab_page_dispose (GObject *object)
 {
   AdwTabPage *self = ADW_TAB_PAGE (object);
 
   set_page_parent (self, NULL);
+  set_page_thumbnail (self, NULL, FALSE);
+  g_clear_handle_id (&self->thumbnail_idle_id, g_source_remove);
+  g_clear_pointer (&self->thumbnail_node, gsk_render_node_unref);
 
   G_OBJECT_CLASS (adw_tab_page_parent_class)->dispose (object);
 }
@@ -234,6 +520,8 @@ adw_tab_page_finalize (GObject *object)
   g_clear_pointer (&self->tooltip, g_free);
   g_clear_object (&self->icon);
   g_clear_object (&self->indicator_icon);
+  g_clear_pointer (&self->search_title, g_free);
+  g_clear_pointer (&self->search_tooltip, g_free);
 
   G_OBJECT_CLASS (adw_tab_page_parent_class)->finalize (object);
 }
@@ -291,6 +579,10 @@ adw_tab_page_get_property (GObject    *object,
     g_value_set_boolean (value, adw_tab_page_get_needs_attention (self));
     break;
 
+  case PAGE_PROP_THUMBNAIL:
+    g_value_set_object (value, adw_tab_page_get_thumbnail (self));
+    break;
+
   default:
     G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
   }
@@ -555,12 +847,36 @@ adw_tab_page_class_init (AdwTabPageClass *klass)
                           FALSE,
                           G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * AdwTabPage:thumbnail: (attributes org.gtk.Property.get=adw_tab_page_get_thumbnail)
+   *
+   * A downscaled image of the page.
+   *
+   * The thumbnail is captured when the page is deselected, and when
+   * [method@Adw.TabPage.invalidate_thumbnail] is called while the page is
+   * visible. It's rendered shortly afterwards, so the property changes
+   * asynchronously. It is `NULL` if the page has never been shown.
+   *
+   * Thumbnails of all pages share a fixed memory budget, and the oldest ones
+   * are dropped when it's exceeded, so this property can become `NULL` again.
+   *
+   * Since: 1.0
+   */
+  page_props[PAGE_PROP_THUMBNAIL] =
+    g_param_spec_object ("thumbnail",
+                         "Thumbnail",
+                         "A downscaled image of the page",
+                         GDK_TYPE_PAINTABLE,
+                         G_PARAM_READABLE | G_PARAM_EXPLICIT_NOTIFY);
+
   g_object_class_install_properties (object_class, LAST_PAGE_PROP, page_props);
 }
 
 static void
 adw_tab_page_init (AdwTabPage *self)
 {
+  self->thumbnail_link.data = self;
+  self->mru_link.data = self;
 }
 
 #define ADW_TYPE_TAB_PAGES (adw_tab_pages_get_type ())
@@ -742,7 +1058,45 @@ page_belongs_to_this_view (AdwTabView *self,
   if (!page)
     return FALSE;
 
-  return gtk_widget_get_parent (page->child) == GTK_WIDGET (self->stack);
+  return page->view == self;
+}
+
+static void
+set_page_child_attached (AdwTabView *self,
+                         AdwTabPage *page,
+                         gboolean    attached)
+{
+  gboolean is_attached = gtk_widget_get_parent (page->child) == GTK_WIDGET (self->stack);
+
+  if (attached == is_attached)
+    return;
+
+  if (attached)
+    gtk_stack_add_child (self->stack, page->child);
+  else
+    gtk_stack_remove (self->stack, page->child);
+}
+
+/* Only the first pages in the most recently used order keep their children in
+ * the stack. Selecting or closing a page only moves pages around the head of
+ * the list, so unless @all is TRUE, only that part is checked. */
+static void
+update_attached_children (AdwTabView *self,
+                          gboolean    all)
+{
+  GList *l;
+  int i = 0;
+
+  for (l = self->mru.head; l; l = l->next) {
+    gboolean attached = !self->detach_hidden_pages || i <= N_ATTACHED_RECENT_PAGES;
+
+    set_page_child_attached (self, l->data, attached);
+
+    if (!all && i > N_ATTACHED_RECENT_PAGES)
+      break;
+
+    i++;
+  }
 }
 
 static inline gboolean
@@ -764,8 +1118,20 @@ attach_page (AdwTabView *self,
   AdwTabPage *parent;
 
   g_list_store_insert (self->children, position, page);
+  g_queue_push_tail_link (&self->mru, &page->mru_link);
 
-  gtk_stack_add_child (self->stack, child);
+  page->view = self;
+
+  /* The child may stay out of the stack, so the page has to own it rather
+   * than the stack */
+  if (g_object_is_floating (child)) {
+    g_object_ref_sink (child);
+    g_object_unref (child);
+  }
+
+  set_page_child_attached (self, page,
+                           !self->detach_hidden_pages ||
+                           self->mru.length <= N_ATTACHED_RECENT_PAGES + 1);
 
   g_object_freeze_notify (G_OBJECT (self));
 
@@ -802,6 +1168,9 @@ set_selected_page (AdwTabView *self,
     if (notify_pages && self->pages)
       old_position = adw_tab_view_get_page_position (self, self->selected_page);
 
+    /* The page is about to be hidden, this is the last chance to capture it */
+    capture_page_thumbnail (self->selected_page);
+
     set_page_selected (self->selected_page, FALSE);
   }
 
@@ -811,6 +1180,12 @@ set_selected_page (AdwTabView *self,
     if (notify_pages && self->pages)
       new_position = adw_tab_view_get_page_position (self, self->selected_page);
 
+    g_queue_unlink (&self->mru, &selected_page->mru_link);
+    g_queue_push_head_link (&self->mru, &selected_page->mru_link);
+
+    if (self->detach_hidden_pages)
+      update_attached_children (self, FALSE);
+
     gtk_stack_set_visible_child (self->stack,
                                  adw_tab_page_get_child (selected_page));
     set_page_selected (self->selected_page, TRUE);
@@ -843,6 +1218,17 @@ select_previous_page (AdwTabView *self,
   if (page != self->selected_page)
     return;
 
+  if (self->close_selection == ADW_TAB_VIEW_CLOSE_SELECTION_RECENT) {
+    /* The selected page is always at the head of the list */
+    GList *next = page->mru_link.next;
+
+    if (next) {
+      adw_tab_view_set_selected_page (self, next->data);
+
+      return;
+    }
+  }
+
   parent = adw_tab_page_get_parent (page);
 
   if (parent && pos > 0) {
@@ -894,6 +1280,7 @@ detach_page (AdwTabView *self,
     set_selected_page (self, NULL, notify_pages);
 
   g_list_store_remove (self->children, pos);
+  g_queue_unlink (&self->mru, &page->mru_link);
 
   g_object_freeze_notify (G_OBJECT (self));
 
@@ -904,7 +1291,11 @@ detach_page (AdwTabView *self,
 
   g_object_thaw_notify (G_OBJECT (self));
 
-  gtk_stack_remove (self->stack, child);
+  set_page_child_attached (self, page, FALSE);
+  page->view = NULL;
+
+  if (self->detach_hidden_pages)
+    update_attached_children (self, FALSE);
 
   g_signal_emit (self, signals[SIGNAL_PAGE_DETACHED], 0, page, pos);
 
@@ -1338,6 +1729,18 @@ adw_tab_view_get_property (GObject    *object,
     g_value_set_object (value, adw_tab_view_get_shortcut_widget (self));
     break;
 
+  case PROP_THROTTLE_BACKGROUND_UPDATES:
+    g_value_set_boolean (value, adw_tab_view_get_throttle_background_updates (self));
+    break;
+
+  case PROP_CLOSE_SELECTION:
+    g_value_set_enum (value, adw_tab_view_get_close_selection (self));
+    break;
+
+  case PROP_DETACH_HIDDEN_PAGES:
+    g_value_set_boolean (value, adw_tab_view_get_detach_hidden_pages (self));
+    break;
+
   case PROP_PAGES:
     g_value_take_object (value, adw_tab_view_get_pages (self));
     break;
@@ -1372,6 +1775,18 @@ adw_tab_view_set_property (GObject      *object,
     adw_tab_view_set_shortcut_widget (self, g_value_get_object (value));
     break;
 
+  case PROP_THROTTLE_BACKGROUND_UPDATES:
+    adw_tab_view_set_throttle_background_updates (self, g_value_get_boolean (value));
+    break;
+
+  case PROP_CLOSE_SELECTION:
+    adw_tab_view_set_close_selection (self, g_value_get_enum (value));
+    break;
+
+  case PROP_DETACH_HIDDEN_PAGES:
+    adw_tab_view_set_detach_hidden_pages (self, g_value_get_boolean (value));
+    break;
+
   default:
     G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
   }
@@ -1525,6 +1940,74 @@ adw_tab_view_class_init (AdwTabViewClass *klass)
                          GTK_TYPE_WIDGET,
                          G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
 
+  /**
+   * AdwTabView:throttle-background-updates: (attributes org.gtk.Property.get=adw_tab_view_get_throttle_background_updates org.gtk.Property.set=adw_tab_view_set_throttle_background_updates)
+   *
+   * Whether to throttle tab updates for pages that aren't selected.
+   *
+   * If set to `TRUE`, changes to the title, tooltip, icons, loading state and
+   * attention state of pages that aren't selected are applied to their tabs
+   * in [class@Adw.TabBar] at most once per frame, no matter how many times
+   * they change in between. The selected page is always updated immediately.
+   *
+   * This is useful for applications where many pages update their title or
+   * loading state frequently in the background, for example terminals or
+   * web browsers.
+   *
+   * Since: 1.0
+   */
+  props[PROP_THROTTLE_BACKGROUND_UPDATES] =
+    g_param_spec_boolean ("throttle-background-updates",
+                          "Throttle background updates",
+                          "Whether to throttle tab updates for pages that aren't selected",
+                          FALSE,
+                          G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
+  /**
+   * AdwTabView:close-selection: (attributes org.gtk.Property.get=adw_tab_view_get_close_selection org.gtk.Property.set=adw_tab_view_set_close_selection)
+   *
+   * Which page to select when the selected page is closed.
+   *
+   * By default, a page next to the closed page is selected. If set to
+   * `ADW_TAB_VIEW_CLOSE_SELECTION_RECENT`, the most recently used page is
+   * selected instead, as returned by
+   * [method@Adw.TabView.get_next_recent_page].
+   *
+   * Since: 1.0
+   */
+  props[PROP_CLOSE_SELECTION] =
+    g_param_spec_enum ("close-selection",
+                       "Close selection",
+                       "Which page to select when the selected page is closed",
+                       ADW_TYPE_TAB_VIEW_CLOSE_SELECTION,
+                       ADW_TAB_VIEW_CLOSE_SELECTION_POSITION,
+                       G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
+  /**
+   * AdwTabView:detach-hidden-pages: (attributes org.gtk.Property.get=adw_tab_view_get_detach_hidden_pages org.gtk.Property.set=adw_tab_view_set_detach_hidden_pages)
+   *
+   * Whether to keep the children of hidden pages out of the widget tree.
+   *
+   * If set to `TRUE`, only the children of the selected page and of a few most
+   * recently selected pages stay in the widget tree. The other children are
+   * kept alive by their pages, but unparented and unrealized, and are added
+   * back when their page is selected.
+   *
+   * This makes style changes, such as switching between light and dark
+   * styles or changing the text scale, only affect the recently used pages,
+   * which helps applications with many pages. Unparented children don't
+   * receive style changes until they're added back, and lose their realized
+   * state, such as GL contexts.
+   *
+   * Since: 1.0
+   */
+  props[PROP_DETACH_HIDDEN_PAGES] =
+    g_param_spec_boolean ("detach-hidden-pages",
+                          "Detach hidden pages",
+                          "Whether to keep the children of hidden pages out of the widget tree",
+                          FALSE,
+                          G_PARAM_READWRITE | G_PARAM_EXPLICIT_NOTIFY);
+
   /**
    * AdwTabView:pages: (attributes org.gtk.Property.get=adw_tab_view_get_pages)
    *
@@ -1876,6 +2359,7 @@ adw_tab_page_set_title (AdwTabPage *self,
 
   g_clear_pointer (&self->title, g_free);
   self->title = g_strdup (title);
+  self->search_keys_valid = FALSE;
 
   g_object_notify_by_pspec (G_OBJECT (self), page_props[PAGE_PROP_TITLE]);
 }
@@ -1918,6 +2402,7 @@ adw_tab_page_set_tooltip (AdwTabPage *self,
 
   g_clear_pointer (&self->tooltip, g_free);
   self->tooltip = g_strdup (tooltip);
+  self->search_keys_valid = FALSE;
 
   g_object_notify_by_pspec (G_OBJECT (self), page_props[PAGE_PROP_TOOLTIP]);
 }
@@ -2136,6 +2621,99 @@ adw_tab_page_set_needs_attention (AdwTabPage *self,
   g_object_notify_by_pspec (G_OBJECT (self), page_props[PAGE_PROP_NEEDS_ATTENTION]);
 }
 
+/**
+ * adw_tab_page_get_thumbnail: (attributes org.gtk.Method.get_property=thumbnail)
+ * @self: a `AdwTabPage`
+ *
+ * Gets the thumbnail of @self.
+ *
+ * Returns: (transfer none) (nullable): the thumbnail of @self
+ *
+ * Since: 1.0
+ */
+GdkPaintable *
+adw_tab_page_get_thumbnail (AdwTabPage *self)
+{
+  g_return_val_if_fail (ADW_IS_TAB_PAGE (self), NULL);
+
+  return self->thumbnail ? GDK_PAINTABLE (self->thumbnail) : NULL;
+}
+
+/**
+ * adw_tab_page_invalidate_thumbnail:
+ * @self: a `AdwTabPage`
+ *
+ * Tells @self that its contents have changed.
+ *
+ * If the page is visible, its thumbnail is captured again, and
+ * [property@Adw.TabPage:thumbnail] is updated shortly afterwards. Otherwise
+ * the current thumbnail is kept until the page is shown and deselected again.
+ *
+ * Since: 1.0
+ */
+void
+adw_tab_page_invalidate_thumbnail (AdwTabPage *self)
+{
+  g_return_if_fail (ADW_IS_TAB_PAGE (self));
+
+  capture_page_thumbnail (self);
+}
+
+/**
+ * adw_tab_page_freeze_updates:
+ * @self: a `AdwTabPage`
+ *
+ * Batches the tab updates caused by changing the properties of @self.
+ *
+ * Until [method@Adw.TabPage.thaw_updates] is called, tabs showing @self apply
+ * the changes to [property@Adw.TabPage:title], [property@Adw.TabPage:tooltip],
+ * [property@Adw.TabPage:icon], [property@Adw.TabPage:indicator-icon],
+ * [property@Adw.TabPage:loading] and [property@Adw.TabPage:needs-attention]
+ * at most once per frame, even when @self is selected. Property notifications
+ * are still emitted right away.
+ *
+ * Calls can be nested.
+ *
+ * Since: 1.0
+ */
+void
+adw_tab_page_freeze_updates (AdwTabPage *self)
+{
+  g_return_if_fail (ADW_IS_TAB_PAGE (self));
+  g_return_if_fail (self->updates_freeze_count < G_MAXUINT);
+
+  self->updates_freeze_count++;
+}
+
+/**
+ * adw_tab_page_thaw_updates:
+ * @self: a `AdwTabPage`
+ *
+ * Reverts the effect of a previous call to
+ * [method@Adw.TabPage.freeze_updates].
+ *
+ * The changes collected while updates were frozen are applied with the next
+ * frame.
+ *
+ * Since: 1.0
+ */
+void
+adw_tab_page_thaw_updates (AdwTabPage *self)
+{
+  g_return_if_fail (ADW_IS_TAB_PAGE (self));
+  g_return_if_fail (self->updates_freeze_count > 0);
+
+  self->updates_freeze_count--;
+}
+
+gboolean
+adw_tab_page_get_updates_frozen (AdwTabPage *self)
+{
+  g_return_val_if_fail (ADW_IS_TAB_PAGE (self), FALSE);
+
+  return self->updates_freeze_count > 0;
+}
+
 /**
  * adw_tab_view_new:
  *
@@ -2523,6 +3101,209 @@ adw_tab_view_set_shortcut_widget (AdwTabView *self,
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_SHORTCUT_WIDGET]);
 }
 
+/**
+ * adw_tab_view_get_throttle_background_updates: (attributes org.gtk.Method.get_property=throttle-background-updates)
+ * @self: a `AdwTabView`
+ *
+ * Gets whether tab updates for pages that aren't selected are throttled.
+ *
+ * Returns: whether background updates are throttled
+ *
+ * Since: 1.0
+ */
+gboolean
+adw_tab_view_get_throttle_background_updates (AdwTabView *self)
+{
+  g_return_val_if_fail (ADW_IS_TAB_VIEW (self), FALSE);
+
+  return self->throttle_background_updates;
+}
+
+/**
+ * adw_tab_view_set_throttle_background_updates: (attributes org.gtk.Method.set_property=throttle-background-updates)
+ * @self: a `AdwTabView`
+ * @throttle: whether to throttle background updates
+ *
+ * Sets whether tab updates for pages that aren't selected are throttled.
+ *
+ * Since: 1.0
+ */
+void
+adw_tab_view_set_throttle_background_updates (AdwTabView *self,
+                                              gboolean    throttle)
+{
+  g_return_if_fail (ADW_IS_TAB_VIEW (self));
+
+  throttle = !!throttle;
+
+  if (throttle == self->throttle_background_updates)
+    return;
+
+  self->throttle_background_updates = throttle;
+
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_THROTTLE_BACKGROUND_UPDATES]);
+}
+
+/**
+ * adw_tab_view_get_close_selection: (attributes org.gtk.Method.get_property=close-selection)
+ * @self: a `AdwTabView`
+ *
+ * Gets which page to select when the selected page is closed.
+ *
+ * Returns: the close selection policy
+ *
+ * Since: 1.0
+ */
+AdwTabViewCloseSelection
+adw_tab_view_get_close_selection (AdwTabView *self)
+{
+  g_return_val_if_fail (ADW_IS_TAB_VIEW (self), ADW_TAB_VIEW_CLOSE_SELECTION_POSITION);
+
+  return self->close_selection;
+}
+
+/**
+ * adw_tab_view_set_close_selection: (attributes org.gtk.Method.set_property=close-selection)
+ * @self: a `AdwTabView`
+ * @close_selection: the close selection policy
+ *
+ * Sets which page to select when the selected page is closed.
+ *
+ * Since: 1.0
+ */
+void
+adw_tab_view_set_close_selection (AdwTabView               *self,
+                                  AdwTabViewCloseSelection  close_selection)
+{
+  g_return_if_fail (ADW_IS_TAB_VIEW (self));
+  g_return_if_fail (close_selection <= ADW_TAB_VIEW_CLOSE_SELECTION_RECENT);
+
+  if (close_selection == self->close_selection)
+    return;
+
+  self->close_selection = close_selection;
+
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_CLOSE_SELECTION]);
+}
+
+/**
+ * adw_tab_view_get_detach_hidden_pages: (attributes org.gtk.Method.get_property=detach-hidden-pages)
+ * @self: a `AdwTabView`
+ *
+ * Gets whether to keep the children of hidden pages out of the widget tree.
+ *
+ * Returns: whether to detach the children of hidden pages
+ *
+ * Since: 1.0
+ */
+gboolean
+adw_tab_view_get_detach_hidden_pages (AdwTabView *self)
+{
+  g_return_val_if_fail (ADW_IS_TAB_VIEW (self), FALSE);
+
+  return self->detach_hidden_pages;
+}
+
+/**
+ * adw_tab_view_set_detach_hidden_pages: (attributes org.gtk.Method.set_property=detach-hidden-pages)
+ * @self: a `AdwTabView`
+ * @detach_hidden_pages: whether to detach the children of hidden pages
+ *
+ * Sets whether to keep the children of hidden pages out of the widget tree.
+ *
+ * Since: 1.0
+ */
+void
+adw_tab_view_set_detach_hidden_pages (AdwTabView *self,
+                                      gboolean    detach_hidden_pages)
+{
+  g_return_if_fail (ADW_IS_TAB_VIEW (self));
+
+  detach_hidden_pages = !!detach_hidden_pages;
+
+  if (detach_hidden_pages == self->detach_hidden_pages)
+    return;
+
+  self->detach_hidden_pages = detach_hidden_pages;
+
+  update_attached_children (self, TRUE);
+
+  g_object_notify_by_pspec (G_OBJECT (self), props[PROP_DETACH_HIDDEN_PAGES]);
+}
+
+/**
+ * adw_tab_view_get_next_recent_page:
+ * @self: a `AdwTabView`
+ * @page: (nullable): a page of @self
+ *
+ * Gets the page that was selected less recently than @page.
+ *
+ * If @page is `NULL`, returns the most recently selected page, which is the
+ * selected page if there is one. Pages that have never been selected come
+ * last, in the order they were added.
+ *
+ * This can be used to implement <kbd>Ctrl</kbd>+<kbd>Tab</kbd> style switching
+ * between recently used pages.
+ *
+ * Returns: (transfer none) (nullable): the next page in recently used order
+ *
+ * Since: 1.0
+ */
+AdwTabPage *
+adw_tab_view_get_next_recent_page (AdwTabView *self,
+                                   AdwTabPage *page)
+{
+  GList *link;
+
+  g_return_val_if_fail (ADW_IS_TAB_VIEW (self), NULL);
+  g_return_val_if_fail (page == NULL || ADW_IS_TAB_PAGE (page), NULL);
+
+  if (!page) {
+    link = self->mru.head;
+  } else {
+    g_return_val_if_fail (page_belongs_to_this_view (self, page), NULL);
+
+    link = page->mru_link.next;
+  }
+
+  return link ? link->data : NULL;
+}
+
+/**
+ * adw_tab_view_get_previous_recent_page:
+ * @self: a `AdwTabView`
+ * @page: (nullable): a page of @self
+ *
+ * Gets the page that was selected more recently than @page.
+ *
+ * If @page is `NULL`, returns the least recently used page. Walking the pages
+ * this way is useful for deciding which pages to unload first.
+ *
+ * Returns: (transfer none) (nullable): the previous page in recently used
+ *   order
+ *
+ * Since: 1.0
+ */
+AdwTabPage *
+adw_tab_view_get_previous_recent_page (AdwTabView *self,
+                                       AdwTabPage *page)
+{
+  GList *link;
+
+  g_return_val_if_fail (ADW_IS_TAB_VIEW (self), NULL);
+  g_return_val_if_fail (page == NULL || ADW_IS_TAB_PAGE (page), NULL);
+
+  if (!page) {
+    link = self->mru.tail;
+  } else {
+    g_return_val_if_fail (page_belongs_to_this_view (self, page), NULL);
+
+    link = page->mru_link.prev;
+  }
+
+  return link ? link->data : NULL;
+}
+
 /**
  * adw_tab_view_set_page_pinned:
  * @self: a `AdwTabView`
@@ -2618,8 +3399,8 @@ adw_tab_view_get_page (AdwTabView *self,
 
   g_return_val_if_fail (ADW_IS_TAB_VIEW (self), NULL);
   g_return_val_if_fail (GTK_IS_WIDGET (child), NULL);
-  g_return_val_if_fail (gtk_widget_get_parent (child) == GTK_WIDGET (self->stack), NULL);
 
+  /* Children of hidden pages may not be in the stack, so check the pages */
   for (i = 0; i < self->n_pages; i++) {
     AdwTabPage *page = adw_tab_view_get_nth_page (self, i);
 
@@ -2627,7 +3408,7 @@ adw_tab_view_get_page (AdwTabView *self,
       return page;
   }
 
-  g_assert_not_reached ();
+  g_return_val_if_reached (NULL);
 }
 
 /**
@@ -3302,6 +4083,90 @@ adw_tab_view_transfer_page (AdwTabView *self,
   adw_tab_view_attach_page (other_view, page, position);
 }
 
+/**
+ * adw_tab_view_search_pages:
+ * @self: a `AdwTabView`
+ * @query: the text to search for
+ * @max_results: the maximum number of results, or 0 for no limit
+ * @n_results: (out): return location for the number of results
+ *
+ * Searches the titles and tooltips of the pages in @self.
+ *
+ * The search ignores case and is done on normalized text. Pages whose title
+ * starts with @query come first, followed by pages where it starts a word,
+ * pages containing it anywhere, and finally pages containing all of its
+ * characters in order. Pages that only match in their tooltip are ranked the
+ * same way, but always after all pages matching in their title. Pages with the
+ * same rank are sorted by position.
+ *
+ * Every search goes through all pages. The normalized title and tooltip of
+ * each page are cached and only computed again after they change, so typing a
+ * query doesn't normalize every title again on each keystroke.
+ *
+ * Returns: (array length=n_results) (transfer full) (nullable): the positions
+ *   of the matching pages, best matches first
+ *
+ * Since: 1.0
+ */
+guint *
+adw_tab_view_search_pages (AdwTabView *self,
+                           const char *query,
+                           guint       max_results,
+                           guint      *n_results)
+{
+  g_autofree char *key = NULL;
+  g_autoptr (GArray) results = NULL;
+  guint *positions;
+  guint i;
+
+  g_return_val_if_fail (ADW_IS_TAB_VIEW (self), NULL);
+  g_return_val_if_fail (query != NULL, NULL);
+  g_return_val_if_fail (n_results != NULL, NULL);
+
+  *n_results = 0;
+
+  key = make_search_key (query, FALSE);
+
+  if (!key)
+    return NULL;
+
+  results = g_array_new (FALSE, FALSE, sizeof (SearchResult));
+
+  for (i = 0; i < (guint) self->n_pages; i++) {
+    AdwTabPage *page = adw_tab_view_get_nth_page (self, (int) i);
+    SearchResult result;
+
+    ensure_search_keys (page);
+
+    result.position = i;
+    result.score = get_match_score (page->search_title, key);
+    result.in_title = result.score >= 0;
+
+    if (!result.in_title)
+      result.score = get_match_score (page->search_tooltip, key);
+
+    if (result.score >= 0)
+      g_array_append_val (results, result);
+  }
+
+  if (results->len == 0)
+    return NULL;
+
+  g_array_sort (results, compare_search_results);
+
+  if (max_results > 0 && results->len > max_results)
+    g_array_set_size (results, max_results);
+
+  positions = g_new (guint, results->len);
+
+  for (i = 0; i < results->len; i++)
+    positions[i] = g_array_index (results, SearchResult, i).position;
+
+  *n_results = results->len;
+
+  return positions;
+}
+
 /**
  * adw_tab_view_get_pages: (attributes org.gtk.Method.get_property=pages)
  * @self: a `AdwTabView`
@@ -3348,3 +4213,20 @@ adw_tab_view_create_window (AdwTabView *self)
 
   return new_view;
 }
+
+GSList *
+adw_tab_view_get_all (void)
+{
+  return tab_view_list;
+}
+
+void
+adw_tab_view_get_thumbnail_stats (guint *n_thumbnails,
+                                  gsize *memory)
+{
+  if (n_thumbnails)
+    *n_thumbnails = thumbnail_queue.length;
+
+  if (memory)
+    *memory = thumbnail_memory;
+}
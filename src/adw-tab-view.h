@@ -15,6 +15,7 @@
 #include "adw-version.h"
 
 #include <gtk/gtk.h>
+#include "adw-enums.h"
 
 G_BEGIN_DECLS
 
@@ -77,11 +78,27 @@ ADW_AVAILABLE_IN_ALL
 void     adw_tab_page_set_needs_attention (AdwTabPage *self,
                                            gboolean    needs_attention);
 
+ADW_AVAILABLE_IN_ALL
+GdkPaintable *adw_tab_page_get_thumbnail (AdwTabPage *self);
+
+ADW_AVAILABLE_IN_ALL
+void adw_tab_page_invalidate_thumbnail (AdwTabPage *self);
+
+ADW_AVAILABLE_IN_ALL
+void adw_tab_page_freeze_updates (AdwTabPage *self);
+ADW_AVAILABLE_IN_ALL
+void adw_tab_page_thaw_updates   (AdwTabPage *self);
+
 #define ADW_TYPE_TAB_VIEW (adw_tab_view_get_type())
 
 ADW_AVAILABLE_IN_ALL
 G_DECLARE_FINAL_TYPE (AdwTabView, adw_tab_view, ADW, TAB_VIEW, GtkWidget)
 
+typedef enum {
+  ADW_TAB_VIEW_CLOSE_SELECTION_POSITION,
+  ADW_TAB_VIEW_CLOSE_SELECTION_RECENT,
+} AdwTabViewCloseSelection;
+
 ADW_AVAILABLE_IN_ALL
 AdwTabView *adw_tab_view_new (void) G_GNUC_WARN_UNUSED_RESULT;
 
@@ -122,6 +139,31 @@ ADW_AVAILABLE_IN_ALL
 void       adw_tab_view_set_shortcut_widget (AdwTabView *self,
                                              GtkWidget  *widget);
 
+ADW_AVAILABLE_IN_ALL
+gboolean adw_tab_view_get_throttle_background_updates (AdwTabView *self);
+ADW_AVAILABLE_IN_ALL
+void     adw_tab_view_set_throttle_background_updates (AdwTabView *self,
+                                                       gboolean    throttle);
+
+ADW_AVAILABLE_IN_ALL
+AdwTabViewCloseSelection adw_tab_view_get_close_selection (AdwTabView               *self);
+ADW_AVAILABLE_IN_ALL
+void                     adw_tab_view_set_close_selection (AdwTabView               *self,
+                                                           AdwTabViewCloseSelection  close_selection);
+
+ADW_AVAILABLE_IN_ALL
+gboolean adw_tab_view_get_detach_hidden_pages (AdwTabView *self);
+ADW_AVAILABLE_IN_ALL
+void     adw_tab_view_set_detach_hidden_pages (AdwTabView *self,
+                                               gboolean    detach_hidden_pages);
+
+ADW_AVAILABLE_IN_ALL
+AdwTabPage *adw_tab_view_get_next_recent_page     (AdwTabView *self,
+                                                   AdwTabPage *page);
+ADW_AVAILABLE_IN_ALL
+AdwTabPage *adw_tab_view_get_previous_recent_page (AdwTabView *self,
+                                                   AdwTabPage *page);
+
 ADW_AVAILABLE_IN_ALL
 void adw_tab_view_set_page_pinned (AdwTabView *self,
                                    AdwTabPage *page,
@@ -210,4 +252,10 @@ void adw_tab_view_transfer_page (AdwTabView *self,
 ADW_AVAILABLE_IN_ALL
 GtkSelectionModel *adw_tab_view_get_pages (AdwTabView *self) G_GNUC_WARN_UNUSED_RESULT;
 
+ADW_AVAILABLE_IN_ALL
+guint *adw_tab_view_search_pages (AdwTabView *self,
+                                  const char *query,
+                                  guint       max_results,
+                                  guint      *n_results) G_GNUC_WARN_UNUSED_RESULT;
+
 G_END_DECLS
@@ -11,7 +11,12 @@
 
 #include "adw-animation-private.h"
 #include "adw-bidi-private.h"
+#include "adw-fade-private.h"
 #include "adw-fading-label-private.h"
+#include "adw-frame-clock-private.h"
+#include "adw-layout-stats-private.h"
+#include "adw-tab-icon-cache-private.h"
+#include "adw-tab-view-private.h"
 
 #define FADE_WIDTH 18
 #define CLOSE_BTN_ANIMATION_DURATION 150
@@ -19,6 +24,14 @@
 #define BASE_WIDTH 118
 #define BASE_WIDTH_PINNED 28
 
+typedef enum {
+  TAB_UPDATE_TITLE           = 1 << 0,
+  TAB_UPDATE_TOOLTIP         = 1 << 1,
+  TAB_UPDATE_ICONS           = 1 << 2,
+  TAB_UPDATE_LOADING         = 1 << 3,
+  TAB_UPDATE_NEEDS_ATTENTION = 1 << 4,
+} TabUpdateFlags;
+
 struct _AdwTab
 {
   GtkWidget parent_instance;
@@ -52,6 +65,10 @@ struct _AdwTab
 
   GskGLShader *shader;
   gboolean shader_compiled;
+  AdwFadeCache fade_cache;
+
+  TabUpdateFlags pending_updates;
+  guint update_tick_id;
 };
 
 G_DEFINE_TYPE (AdwTab, adw_tab, GTK_TYPE_WIDGET)
@@ -141,6 +158,7 @@ update_state (AdwTab *self)
                          (AdwAnimationDoneCallback) close_btn_animation_done_cb,
                          self);
 
+    adw_animation_set_essential (self->close_btn_animation, FALSE);
     adw_animation_start (self->close_btn_animation);
   }
 }
@@ -172,6 +190,8 @@ update_title (AdwTab *self)
     (title_direction == PANGO_DIRECTION_LTR && direction == GTK_TEXT_DIR_RTL) ||
     (title_direction == PANGO_DIRECTION_RTL && direction == GTK_TEXT_DIR_LTR);
 
+  adw_fading_label_set_label (ADW_FADING_LABEL (self->title), title);
+
   if (self->title_inverted != title_inverted) {
     self->title_inverted = title_inverted;
     gtk_widget_queue_allocate (GTK_WIDGET (self));
@@ -201,15 +221,24 @@ update_icons (AdwTab *self)
   if (self->pinned && !gicon)
     gicon = adw_tab_view_get_default_icon (self->view);
 
-  gtk_image_set_from_gicon (self->icon, gicon);
+  adw_tab_icon_cache_set_image (self->icon, gicon);
   gtk_widget_set_visible (self->icon_stack,
                           (gicon != NULL || loading) &&
                           (!self->pinned || indicator == NULL));
   gtk_stack_set_visible_child_name (GTK_STACK (self->icon_stack), name);
 
+  adw_tab_icon_cache_set_image (self->indicator_icon, indicator);
   gtk_widget_set_visible (self->indicator_btn, indicator != NULL);
 }
 
+static void
+scale_factor_changed_cb (AdwTab *self)
+{
+  /* Cached icons are loaded for a given scale */
+  if (self->page)
+    update_icons (self);
+}
+
 static void
 update_indicator (AdwTab *self)
 {
@@ -235,6 +264,98 @@ update_loading (AdwTab *self)
                    adw_tab_page_get_loading (self->page));
 }
 
+static void
+cancel_update_tick (AdwTab *self)
+{
+  if (!self->update_tick_id)
+    return;
+
+  adw_frame_clock_remove_tick_callback (GTK_WIDGET (self), self->update_tick_id);
+  self->update_tick_id = 0;
+}
+
+static void
+flush_updates (AdwTab *self)
+{
+  TabUpdateFlags flags = self->pending_updates;
+
+  self->pending_updates = 0;
+  cancel_update_tick (self);
+
+  if (!self->page)
+    return;
+
+  /* update_title() and update_loading() also do the latter update */
+  if (flags & TAB_UPDATE_TITLE)
+    update_title (self);
+  else if (flags & TAB_UPDATE_TOOLTIP)
+    update_tooltip (self);
+
+  if (flags & TAB_UPDATE_LOADING)
+    update_loading (self);
+  else if (flags & TAB_UPDATE_ICONS)
+    update_icons (self);
+
+  if (flags & TAB_UPDATE_NEEDS_ATTENTION)
+    update_needs_attention (self);
+}
+
+static gboolean
+update_tick_cb (GtkWidget     *widget,
+                GdkFrameClock *frame_clock,
+                gpointer       user_data)
+{
+  AdwTab *self = ADW_TAB (widget);
+
+  self->update_tick_id = 0;
+
+  flush_updates (self);
+
+  return G_SOURCE_REMOVE;
+}
+
+static void
+queue_update (AdwTab         *self,
+              TabUpdateFlags  flags)
+{
+  self->pending_updates |= flags;
+
+  if (!adw_tab_page_get_updates_frozen (self->page) &&
+      (self->selected ||
+       !adw_tab_view_get_throttle_background_updates (self->view))) {
+    flush_updates (self);
+
+    return;
+  }
+
+  /* Nothing to see, catch up when mapped */
+  if (!gtk_widget_get_mapped (GTK_WIDGET (self)) &&
+      !adw_frame_clock_get_virtual ())
+    return;
+
+  if (!self->update_tick_id)
+    self->update_tick_id =
+      adw_frame_clock_add_tick_callback (GTK_WIDGET (self), update_tick_cb, NULL, NULL);
+}
+
+static void
+page_notify_cb (AdwTab     *self,
+                GParamSpec *pspec)
+{
+  const char *name = g_param_spec_get_name (pspec);
+
+  if (!g_strcmp0 (name, "title"))
+    queue_update (self, TAB_UPDATE_TITLE);
+  else if (!g_strcmp0 (name, "tooltip"))
+    queue_update (self, TAB_UPDATE_TOOLTIP);
+  else if (!g_strcmp0 (name, "icon") || !g_strcmp0 (name, "indicator-icon"))
+    queue_update (self, TAB_UPDATE_ICONS);
+  else if (!g_strcmp0 (name, "loading"))
+    queue_update (self, TAB_UPDATE_LOADING);
+  else if (!g_strcmp0 (name, "needs-attention"))
+    queue_update (self, TAB_UPDATE_NEEDS_ATTENTION);
+}
+
 static void
 update_selected (AdwTab *self)
 {
@@ -243,6 +364,10 @@ update_selected (AdwTab *self)
   if (self->page)
     self->selected |= adw_tab_page_get_selected (self->page);
 
+  /* Don't show stale state on the selected tab */
+  if (self->selected && self->pending_updates)
+    flush_updates (self);
+
   update_state (self);
   update_indicator (self);
 }
@@ -323,7 +448,7 @@ ensure_shader (AdwTab *self)
   GskRenderer *renderer;
   g_autoptr (GError) error = NULL;
 
-  if (self->shader)
+  if (self->shader || adw_fade_shaders_disabled ())
     return;
 
   self->shader = gsk_gl_shader_new_from_resource ("/org/gnome/Adwaita/glsl/fade.glsl");
@@ -369,6 +494,8 @@ adw_tab_measure (GtkWidget      *widget,
   AdwTab *self = ADW_TAB (widget);
   int min = 0, nat = 0;
 
+  ADW_LAYOUT_STATS_MEASURE (widget);
+
   if (orientation == GTK_ORIENTATION_HORIZONTAL) {
     nat = self->pinned ? BASE_WIDTH_PINNED : BASE_WIDTH;
   } else {
@@ -515,6 +642,8 @@ adw_tab_size_allocate (GtkWidget *widget,
   GtkAllocation child_alloc;
   int allocated_width, width_diff;
 
+  ADW_LAYOUT_STATS_ALLOCATE (widget);
+
   if (!self->icon_stack ||
       !self->indicator_btn ||
       !self->title ||
@@ -539,6 +668,9 @@ adw_tab_map (GtkWidget *widget)
 
   GTK_WIDGET_CLASS (adw_tab_parent_class)->map (widget);
 
+  if (self->pending_updates)
+    flush_updates (self);
+
   update_spinner (self);
 }
 
@@ -584,23 +716,27 @@ adw_tab_snapshot (GtkWidget   *widget,
                                                               "strengthLeft", is_rtl ? opacity : 0.0f,
                                                               "strengthRight", is_rtl ? 0.0f : opacity,
                                                               NULL));
-    } else {
-      bounds.size.width -= offset;
-
-      if (is_rtl)
-        bounds.origin.x += offset;
 
-      gtk_snapshot_push_clip (snapshot, &bounds);
-    }
-  }
+      gtk_widget_snapshot_child (widget, self->title, snapshot);
 
-  gtk_widget_snapshot_child (widget, self->title, snapshot);
-
-  if (draw_fade) {
-    if (self->shader_compiled)
       gtk_snapshot_gl_shader_pop_texture (snapshot);
-
-    gtk_snapshot_pop (snapshot);
+      gtk_snapshot_pop (snapshot);
+    } else {
+      GtkSnapshot *title_snapshot = gtk_snapshot_new ();
+      g_autoptr (GskRenderNode) title_node = NULL;
+
+      gtk_widget_snapshot_child (widget, self->title, title_snapshot);
+      title_node = gtk_snapshot_free_to_node (title_snapshot);
+
+      adw_fade_append (snapshot, &self->fade_cache,
+                       gtk_widget_get_scale_factor (widget), &bounds, title_node,
+                       is_rtl ? offset : 0.0f,
+                       is_rtl ? 0.0f : offset,
+                       is_rtl ? opacity : 0.0f,
+                       is_rtl ? 0.0f : opacity);
+    }
+  } else {
+    gtk_widget_snapshot_child (widget, self->title, snapshot);
   }
 
   gtk_widget_snapshot_child (widget, self->close_btn, snapshot);
@@ -721,7 +857,9 @@ adw_tab_dispose (GObject *object)
 
   adw_tab_set_page (self, NULL);
 
+  cancel_update_tick (self);
   g_clear_object (&self->shader);
+  adw_fade_cache_clear (&self->fade_cache);
   gtk_widget_unparent (self->indicator_btn);
   gtk_widget_unparent (self->icon_stack);
   gtk_widget_unparent (self->title);
@@ -844,6 +982,9 @@ adw_tab_init (AdwTab *self)
   g_type_ensure (ADW_TYPE_FADING_LABEL);
 
   gtk_widget_init_template (GTK_WIDGET (self));
+
+  g_signal_connect (self, "notify::scale-factor",
+                    G_CALLBACK (scale_factor_changed_cb), NULL);
 }
 
 AdwTab *
@@ -878,14 +1019,13 @@ adw_tab_set_page (AdwTab     *self,
 
   if (self->page) {
     g_signal_handlers_disconnect_by_func (self->page, update_selected, self);
-    g_signal_handlers_disconnect_by_func (self->page, update_title, self);
-    g_signal_handlers_disconnect_by_func (self->page, update_tooltip, self);
-    g_signal_handlers_disconnect_by_func (self->page, update_icons, self);
+    g_signal_handlers_disconnect_by_func (self->page, page_notify_cb, self);
     g_signal_handlers_disconnect_by_func (self->page, update_indicator, self);
-    g_signal_handlers_disconnect_by_func (self->page, update_needs_attention, self);
-    g_signal_handlers_disconnect_by_func (self->page, update_loading, self);
   }
 
+  self->pending_updates = 0;
+  cancel_update_tick (self);
+
   g_set_object (&self->page, page);
 
   if (self->page) {
@@ -903,25 +1043,25 @@ adw_tab_set_page (AdwTab     *self,
                              G_CALLBACK (update_selected), self,
                              G_CONNECT_SWAPPED);
     g_signal_connect_object (self->page, "notify::title",
-                             G_CALLBACK (update_title), self,
+                             G_CALLBACK (page_notify_cb), self,
                              G_CONNECT_SWAPPED);
     g_signal_connect_object (self->page, "notify::tooltip",
-                             G_CALLBACK (update_tooltip), self,
+                             G_CALLBACK (page_notify_cb), self,
                              G_CONNECT_SWAPPED);
     g_signal_connect_object (self->page, "notify::icon",
-                             G_CALLBACK (update_icons), self,
+                             G_CALLBACK (page_notify_cb), self,
                              G_CONNECT_SWAPPED);
     g_signal_connect_object (self->page, "notify::indicator-icon",
-                             G_CALLBACK (update_icons), self,
+                             G_CALLBACK (page_notify_cb), self,
                              G_CONNECT_SWAPPED);
     g_signal_connect_object (self->page, "notify::indicator-activatable",
                              G_CALLBACK (update_indicator), self,
                              G_CONNECT_SWAPPED);
     g_signal_connect_object (self->page, "notify::needs-attention",
-                             G_CALLBACK (update_needs_attention), self,
+                             G_CALLBACK (page_notify_cb), self,
                              G_CONNECT_SWAPPED);
     g_signal_connect_object (self->page, "notify::loading",
-                             G_CALLBACK (update_loading), self,
+                             G_CALLBACK (page_notify_cb), self,
                              G_CONNECT_SWAPPED);
   }
 
@@ -28,14 +28,16 @@ struct _AdwViewSwitcherButton
 {
   GtkToggleButton parent_instance;
 
-  GtkBox *horizontal_box;
-  GtkImage *horizontal_image;
+  GtkStack *stack;
+
+  /* The boxes are only created once the orientation is used */
+  GtkWidget *horizontal_box;
+  AdwIndicatorBin *horizontal_indicator_bin;
   GtkLabel *horizontal_label_active;
   GtkLabel *horizontal_label_inactive;
   GtkStack *horizontal_label_stack;
-  GtkStack *stack;
-  GtkBox *vertical_box;
-  GtkImage *vertical_image;
+  GtkWidget *vertical_box;
+  AdwIndicatorBin *vertical_indicator_bin;
   GtkLabel *vertical_label_active;
   GtkLabel *vertical_label_inactive;
   GtkStack *vertical_label_stack;
@@ -44,6 +46,7 @@ struct _AdwViewSwitcherButton
   char *label;
   GtkOrientation orientation;
   gboolean needs_attention;
+  PangoEllipsizeMode narrow_ellipsize;
 
   guint switch_timer;
 };
@@ -63,18 +66,151 @@ adw_view_switcher_button_switch_timeout (AdwViewSwitcherButton *self)
   return G_SOURCE_REMOVE;
 }
 
+static void
+update_indicators (AdwViewSwitcherButton *self)
+{
+  gboolean show_indicator = self->needs_attention &&
+    !gtk_toggle_button_get_active (GTK_TOGGLE_BUTTON (self));
+
+  if (self->horizontal_indicator_bin)
+    adw_indicator_bin_set_show_indicator (self->horizontal_indicator_bin, show_indicator);
+
+  if (self->vertical_indicator_bin)
+    adw_indicator_bin_set_show_indicator (self->vertical_indicator_bin, show_indicator);
+}
+
 static void
 active_changed_cb (AdwViewSwitcherButton *self)
 {
+  gboolean active;
+
   g_assert (ADW_IS_VIEW_SWITCHER_BUTTON (self));
 
-  if (gtk_toggle_button_get_active (GTK_TOGGLE_BUTTON (self))) {
-    gtk_stack_set_visible_child (self->horizontal_label_stack, GTK_WIDGET (self->horizontal_label_active));
-    gtk_stack_set_visible_child (self->vertical_label_stack, GTK_WIDGET (self->vertical_label_active));
-  } else {
-    gtk_stack_set_visible_child (self->horizontal_label_stack, GTK_WIDGET (self->horizontal_label_inactive));
-    gtk_stack_set_visible_child (self->vertical_label_stack, GTK_WIDGET (self->vertical_label_inactive));
-  }
+  active = gtk_toggle_button_get_active (GTK_TOGGLE_BUTTON (self));
+
+  if (self->horizontal_label_stack)
+    gtk_stack_set_visible_child (self->horizontal_label_stack,
+                                 GTK_WIDGET (active ? self->horizontal_label_active :
+                                                      self->horizontal_label_inactive));
+
+  if (self->vertical_label_stack)
+    gtk_stack_set_visible_child (self->vertical_label_stack,
+                                 GTK_WIDGET (active ? self->vertical_label_active :
+                                                      self->vertical_label_inactive));
+
+  update_indicators (self);
+}
+
+static GtkLabel *
+create_label (AdwViewSwitcherButton *self,
+              gboolean               active)
+{
+  GtkWidget *label = gtk_label_new (NULL);
+
+  g_object_bind_property (self, "label", label, "label",
+                          G_BINDING_SYNC_CREATE | G_BINDING_BIDIRECTIONAL);
+  g_object_bind_property (self, "use-underline", label, "use-underline",
+                          G_BINDING_SYNC_CREATE | G_BINDING_BIDIRECTIONAL);
+
+  gtk_label_set_mnemonic_widget (GTK_LABEL (label), GTK_WIDGET (self));
+
+  if (active)
+    gtk_widget_add_css_class (label, "active");
+
+  return GTK_LABEL (label);
+}
+
+static GtkWidget *
+create_image (AdwViewSwitcherButton *self)
+{
+  GtkWidget *image = gtk_image_new ();
+
+  g_object_bind_property (self, "icon-name", image, "icon-name",
+                          G_BINDING_SYNC_CREATE);
+
+  return image;
+}
+
+static GtkStack *
+create_label_stack (AdwViewSwitcherButton  *self,
+                    GtkLabel              **label_inactive,
+                    GtkLabel              **label_active)
+{
+  GtkWidget *stack = gtk_stack_new ();
+
+  *label_inactive = create_label (self, FALSE);
+  *label_active = create_label (self, TRUE);
+
+  gtk_stack_add_child (GTK_STACK (stack), GTK_WIDGET (*label_inactive));
+  gtk_stack_add_child (GTK_STACK (stack), GTK_WIDGET (*label_active));
+
+  return GTK_STACK (stack);
+}
+
+static void
+ensure_horizontal_box (AdwViewSwitcherButton *self)
+{
+  GtkWidget *indicator_bin;
+
+  if (self->horizontal_box)
+    return;
+
+  self->horizontal_box = gtk_box_new (GTK_ORIENTATION_HORIZONTAL, 8);
+  gtk_widget_set_halign (self->horizontal_box, GTK_ALIGN_CENTER);
+  gtk_widget_set_valign (self->horizontal_box, GTK_ALIGN_CENTER);
+  gtk_widget_add_css_class (self->horizontal_box, "wide");
+
+  gtk_box_append (GTK_BOX (self->horizontal_box), create_image (self));
+
+  self->horizontal_label_stack =
+    create_label_stack (self,
+                        &self->horizontal_label_inactive,
+                        &self->horizontal_label_active);
+
+  indicator_bin = adw_indicator_bin_new ();
+  adw_indicator_bin_set_contained (ADW_INDICATOR_BIN (indicator_bin), TRUE);
+  adw_indicator_bin_set_child (ADW_INDICATOR_BIN (indicator_bin),
+                               GTK_WIDGET (self->horizontal_label_stack));
+  gtk_box_append (GTK_BOX (self->horizontal_box), indicator_bin);
+  self->horizontal_indicator_bin = ADW_INDICATOR_BIN (indicator_bin);
+
+  gtk_stack_add_child (self->stack, self->horizontal_box);
+
+  active_changed_cb (self);
+}
+
+static void
+ensure_vertical_box (AdwViewSwitcherButton *self)
+{
+  GtkWidget *indicator_bin;
+
+  if (self->vertical_box)
+    return;
+
+  self->vertical_box = gtk_box_new (GTK_ORIENTATION_VERTICAL, 4);
+  gtk_widget_set_halign (self->vertical_box, GTK_ALIGN_CENTER);
+  gtk_widget_set_valign (self->vertical_box, GTK_ALIGN_CENTER);
+  gtk_widget_add_css_class (self->vertical_box, "narrow");
+
+  indicator_bin = adw_indicator_bin_new ();
+  gtk_widget_set_halign (indicator_bin, GTK_ALIGN_CENTER);
+  adw_indicator_bin_set_child (ADW_INDICATOR_BIN (indicator_bin),
+                               create_image (self));
+  gtk_box_append (GTK_BOX (self->vertical_box), indicator_bin);
+  self->vertical_indicator_bin = ADW_INDICATOR_BIN (indicator_bin);
+
+  self->vertical_label_stack =
+    create_label_stack (self,
+                        &self->vertical_label_inactive,
+                        &self->vertical_label_active);
+  gtk_label_set_ellipsize (self->vertical_label_active, self->narrow_ellipsize);
+  gtk_label_set_ellipsize (self->vertical_label_inactive, self->narrow_ellipsize);
+  gtk_box_append (GTK_BOX (self->vertical_box),
+                  GTK_WIDGET (self->vertical_label_stack));
+
+  gtk_stack_add_child (self->stack, self->vertical_box);
+
+  active_changed_cb (self);
 }
 
 static void
@@ -114,18 +250,14 @@ set_orientation (AdwViewSwitcherButton *self,
 
   self->orientation = orientation;
 
-  gtk_stack_set_visible_child (self->stack,
-                               GTK_WIDGET (self->orientation == GTK_ORIENTATION_VERTICAL ?
-                                             self->vertical_box :
-                                             self->horizontal_box));
-}
+  /* Both layouts are built once the button is in a window */
+  if (!gtk_widget_get_root (GTK_WIDGET (self)))
+    return;
 
-static bool
-should_show_indicator (AdwViewSwitcherButton *self,
-                       gboolean               needs_attention,
-                       gboolean               active)
-{
-  return needs_attention && !active;
+  gtk_stack_set_visible_child (self->stack,
+                               self->orientation == GTK_ORIENTATION_VERTICAL ?
+                                 self->vertical_box :
+                                 self->horizontal_box);
 }
 
 static void
@@ -182,6 +314,24 @@ adw_view_switcher_button_set_property (GObject      *object,
   }
 }
 
+static void
+adw_view_switcher_button_root (GtkWidget *widget)
+{
+  AdwViewSwitcherButton *self = ADW_VIEW_SWITCHER_BUTTON (widget);
+
+  GTK_WIDGET_CLASS (adw_view_switcher_button_parent_class)->root (widget);
+
+  /* The stack is vertically homogeneous, so the height of the button depends
+   * on both layouts even though only one of them is shown */
+  ensure_horizontal_box (self);
+  ensure_vertical_box (self);
+
+  gtk_stack_set_visible_child (self->stack,
+                               self->orientation == GTK_ORIENTATION_VERTICAL ?
+                                 self->vertical_box :
+                                 self->horizontal_box);
+}
+
 static void
 adw_view_switcher_button_dispose (GObject *object)
 {
@@ -214,6 +364,8 @@ adw_view_switcher_button_class_init (AdwViewSwitcherButtonClass *klass)
   object_class->dispose = adw_view_switcher_button_dispose;
   object_class->finalize = adw_view_switcher_button_finalize;
 
+  widget_class->root = adw_view_switcher_button_root;
+
   g_object_class_override_property (object_class,
                                     PROP_LABEL,
                                     "label");
@@ -265,21 +417,10 @@ adw_view_switcher_button_class_init (AdwViewSwitcherButtonClass *klass)
 
   gtk_widget_class_set_template_from_resource (widget_class,
                                                "/org/gnome/Adwaita/ui/adw-view-switcher-button.ui");
-  gtk_widget_class_bind_template_child (widget_class, AdwViewSwitcherButton, horizontal_box);
-  gtk_widget_class_bind_template_child (widget_class, AdwViewSwitcherButton, horizontal_image);
-  gtk_widget_class_bind_template_child (widget_class, AdwViewSwitcherButton, horizontal_label_active);
-  gtk_widget_class_bind_template_child (widget_class, AdwViewSwitcherButton, horizontal_label_inactive);
-  gtk_widget_class_bind_template_child (widget_class, AdwViewSwitcherButton, horizontal_label_stack);
   gtk_widget_class_bind_template_child (widget_class, AdwViewSwitcherButton, stack);
-  gtk_widget_class_bind_template_child (widget_class, AdwViewSwitcherButton, vertical_box);
-  gtk_widget_class_bind_template_child (widget_class, AdwViewSwitcherButton, vertical_image);
-  gtk_widget_class_bind_template_child (widget_class, AdwViewSwitcherButton, vertical_label_active);
-  gtk_widget_class_bind_template_child (widget_class, AdwViewSwitcherButton, vertical_label_inactive);
-  gtk_widget_class_bind_template_child (widget_class, AdwViewSwitcherButton, vertical_label_stack);
   gtk_widget_class_bind_template_callback (widget_class, active_changed_cb);
   gtk_widget_class_bind_template_callback (widget_class, drag_enter_cb);
   gtk_widget_class_bind_template_callback (widget_class, drag_leave_cb);
-  gtk_widget_class_bind_template_callback (widget_class, should_show_indicator);
 
   gtk_widget_class_set_accessible_role (widget_class, GTK_ACCESSIBLE_ROLE_TAB);
 }
@@ -288,21 +429,11 @@ static void
 adw_view_switcher_button_init (AdwViewSwitcherButton *self)
 {
   self->icon_name = g_strdup ("image-missing");
-
-  g_type_ensure (ADW_TYPE_INDICATOR_BIN);
+  self->narrow_ellipsize = PANGO_ELLIPSIZE_NONE;
 
   gtk_widget_init_template (GTK_WIDGET (self));
 
-  gtk_stack_set_visible_child (GTK_STACK (self->stack), GTK_WIDGET (self->horizontal_box));
-
   gtk_widget_set_focus_on_click (GTK_WIDGET (self), FALSE);
-
-  gtk_label_set_mnemonic_widget (self->horizontal_label_active, GTK_WIDGET (self));
-  gtk_label_set_mnemonic_widget (self->horizontal_label_inactive, GTK_WIDGET (self));
-  gtk_label_set_mnemonic_widget (self->vertical_label_active, GTK_WIDGET (self));
-  gtk_label_set_mnemonic_widget (self->vertical_label_inactive, GTK_WIDGET (self));
-
-  active_changed_cb (self);
 }
 
 /**
@@ -353,15 +484,14 @@ adw_view_switcher_button_set_icon_name (AdwViewSwitcherButton *self,
 {
   g_return_if_fail (ADW_IS_VIEW_SWITCHER_BUTTON (self));
 
+  if (!icon_name || !*icon_name)
+    icon_name = "image-missing";
+
   if (!g_strcmp0 (self->icon_name, icon_name))
     return;
 
   g_free (self->icon_name);
-
-  if (icon_name && strlen (icon_name) > 0)
-    self->icon_name = g_strdup (icon_name);
-  else
-    self->icon_name = g_strdup ("image-missing");
+  self->icon_name = g_strdup (icon_name);
 
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_ICON_NAME]);
 }
@@ -406,6 +536,8 @@ adw_view_switcher_button_set_needs_attention (AdwViewSwitcherButton *self,
 
   self->needs_attention = needs_attention;
 
+  update_indicators (self);
+
   g_object_notify_by_pspec (G_OBJECT (self), props[PROP_NEEDS_ATTENTION]);
 }
 
@@ -467,6 +599,14 @@ adw_view_switcher_button_set_narrow_ellipsize (AdwViewSwitcherButton *self,
   g_return_if_fail (ADW_IS_VIEW_SWITCHER_BUTTON (self));
   g_return_if_fail (mode >= PANGO_ELLIPSIZE_NONE && mode <= PANGO_ELLIPSIZE_END);
 
+  if (self->narrow_ellipsize == mode)
+    return;
+
+  self->narrow_ellipsize = mode;
+
+  if (!self->vertical_box)
+    return;
+
   gtk_label_set_ellipsize (self->vertical_label_active, mode);
   gtk_label_set_ellipsize (self->vertical_label_inactive, mode);
 }
@@ -493,13 +633,17 @@ adw_view_switcher_button_get_size (AdwViewSwitcherButton *self,
   /* gtk_widget_get_preferred_width() doesn't accept both its out parameters to
    * be NULL, so we must have guards.
    */
-  if (h_min_width != NULL || h_nat_width != NULL)
-    gtk_widget_measure (GTK_WIDGET (self->horizontal_box),
+  if (h_min_width != NULL || h_nat_width != NULL) {
+    ensure_horizontal_box (self);
+    gtk_widget_measure (self->horizontal_box,
                         GTK_ORIENTATION_HORIZONTAL, -1,
                         h_min_width, h_nat_width, NULL, NULL);
+  }
 
-  if (v_min_width != NULL || v_nat_width != NULL)
-    gtk_widget_measure (GTK_WIDGET (self->vertical_box),
+  if (v_min_width != NULL || v_nat_width != NULL) {
+    ensure_vertical_box (self);
+    gtk_widget_measure (self->vertical_box,
                         GTK_ORIENTATION_HORIZONTAL, -1,
                         v_min_width, v_nat_width, NULL, NULL);
+  }
 }
@@ -11,6 +11,8 @@
 #include "config.h"
 
 #include "adw-enums.h"
+#include "adw-frame-clock-private.h"
+#include "adw-layout-stats-private.h"
 #include "adw-view-switcher.h"
 #include "adw-view-switcher-button-private.h"
 
@@ -68,6 +70,9 @@ struct _AdwViewSwitcher
   GHashTable *buttons;
   GtkBox *box;
 
+  GHashTable *pending_pages;
+  guint update_tick_id;
+
   AdwViewSwitcherPolicy policy;
   PangoEllipsizeMode narrow_ellipsize;
 };
@@ -114,25 +119,56 @@ update_button (AdwViewSwitcher *self,
                 "use-underline", &use_underline,
                 NULL);
 
-  g_object_set (G_OBJECT (button),
-                "icon-name", icon_name,
-                "label", title,
-                "needs-attention", needs_attention,
-                "use-underline", use_underline,
-                NULL);
+  /* The setters do nothing when the value doesn't change, so only what
+   * actually differs gets updated and queues a resize.
+   */
+  adw_view_switcher_button_set_icon_name (ADW_VIEW_SWITCHER_BUTTON (button), icon_name);
+  adw_view_switcher_button_set_label (ADW_VIEW_SWITCHER_BUTTON (button), title);
+  adw_view_switcher_button_set_needs_attention (ADW_VIEW_SWITCHER_BUTTON (button), needs_attention);
+  gtk_button_set_use_underline (GTK_BUTTON (button), use_underline);
 
   gtk_widget_set_visible (button, visible && (title != NULL || icon_name != NULL));
 }
 
+static gboolean
+update_pending_buttons_cb (GtkWidget     *widget,
+                           GdkFrameClock *frame_clock,
+                           gpointer       user_data)
+{
+  AdwViewSwitcher *self = ADW_VIEW_SWITCHER (widget);
+  GHashTableIter iter;
+  GtkStackPage *page;
+
+  self->update_tick_id = 0;
+
+  g_hash_table_iter_init (&iter, self->pending_pages);
+  while (g_hash_table_iter_next (&iter, (gpointer *) &page, NULL)) {
+    GtkWidget *button = g_hash_table_lookup (self->buttons, page);
+
+    if (button)
+      update_button (self, page, button);
+
+    g_hash_table_iter_remove (&iter);
+  }
+
+  return G_SOURCE_REMOVE;
+}
+
 static void
 on_page_updated (GtkStackPage    *page,
                  GParamSpec      *pspec,
                  AdwViewSwitcher *self)
 {
-  GtkWidget *button;
+  /* Pages can change several properties in a row, e.g. when updating a
+   * badge, so coalesce them into a single update on the next frame.
+   */
+  g_hash_table_add (self->pending_pages, page);
 
-  button = g_hash_table_lookup (self->buttons, page);
-  update_button (self, page, button);
+  if (!self->update_tick_id)
+    self->update_tick_id =
+      adw_frame_clock_add_tick_callback (GTK_WIDGET (self),
+                                         update_pending_buttons_cb,
+                                         NULL, NULL);
 }
 
 static void
@@ -163,7 +199,11 @@ add_child (AdwViewSwitcher *self,
   adw_view_switcher_button_set_narrow_ellipsize (button, self->narrow_ellipsize);
 
   g_signal_connect (button, "notify::active", G_CALLBACK (on_button_toggled), self);
-  g_signal_connect (page, "notify", G_CALLBACK (on_page_updated), self);
+  g_signal_connect (page, "notify::title", G_CALLBACK (on_page_updated), self);
+  g_signal_connect (page, "notify::icon-name", G_CALLBACK (on_page_updated), self);
+  g_signal_connect (page, "notify::needs-attention", G_CALLBACK (on_page_updated), self);
+  g_signal_connect (page, "notify::visible", G_CALLBACK (on_page_updated), self);
+  g_signal_connect (page, "notify::use-underline", G_CALLBACK (on_page_updated), self);
 
   g_hash_table_insert (self->buttons, g_object_ref (page), button);
 
@@ -193,8 +233,14 @@ clear_switcher (AdwViewSwitcher *self)
     g_signal_handlers_disconnect_by_func (page, on_page_updated, self);
     g_hash_table_iter_remove (&iter);
   }
-}
 
+  g_hash_table_remove_all (self->pending_pages);
+
+  if (self->update_tick_id) {
+    adw_frame_clock_remove_tick_callback (GTK_WIDGET (self), self->update_tick_id);
+    self->update_tick_id = 0;
+  }
+}
 
 static void
 items_changed_cb (AdwViewSwitcher *self)
@@ -335,6 +381,7 @@ adw_view_switcher_finalize (GObject *object)
   AdwViewSwitcher *self = ADW_VIEW_SWITCHER (object);
 
   g_hash_table_destroy (self->buttons);
+  g_hash_table_destroy (self->pending_pages);
 
   G_OBJECT_CLASS (adw_view_switcher_parent_class)->finalize (object);
 }
@@ -356,6 +403,8 @@ adw_view_switcher_measure (GtkWidget      *widget,
   int min = 0, nat = 0;
   int n_children = 0;
 
+  ADW_LAYOUT_STATS_MEASURE (widget);
+
   g_hash_table_iter_init (&iter, self->buttons);
 
   if (orientation == GTK_ORIENTATION_HORIZONTAL) {
@@ -462,6 +511,8 @@ adw_view_switcher_size_allocate (GtkWidget *widget,
   GHashTableIter iter;
   AdwViewSwitcherButton *button;
 
+  ADW_LAYOUT_STATS_ALLOCATE (widget);
+
   orientation = is_narrow (ADW_VIEW_SWITCHER (widget), width) ?
     GTK_ORIENTATION_VERTICAL :
     GTK_ORIENTATION_HORIZONTAL;
@@ -550,6 +601,7 @@ adw_view_switcher_init (AdwViewSwitcher *self)
   gtk_widget_set_parent (GTK_WIDGET (self->box), GTK_WIDGET (self));
 
   self->buttons = g_hash_table_new_full (g_direct_hash, g_direct_equal, g_object_unref, NULL);
+  self->pending_pages = g_hash_table_new (g_direct_hash, g_direct_equal);
 }
 
 /**
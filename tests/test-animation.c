@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include <adwaita.h>
+
+#include "adw-animation-private.h"
+#include "adw-frame-clock-private.h"
+
+typedef struct {
+  double value;
+  int n_values;
+  int n_done;
+} AnimationData;
+
+static void
+value_cb (double         value,
+          AnimationData *data)
+{
+  data->value = value;
+  data->n_values++;
+}
+
+static void
+done_cb (AnimationData *data)
+{
+  data->n_done++;
+}
+
+static void
+test_adw_animation_enable_animations (void)
+{
+  g_autoptr (GtkWidget) widget = g_object_ref_sink (gtk_button_new ());
+  GtkSettings *settings = gtk_widget_get_settings (widget);
+
+  g_object_set (settings, "gtk-enable-animations", TRUE, NULL);
+  g_assert_true (adw_get_enable_animations (widget));
+
+  /* The value is cached, make sure it's still updated */
+  g_object_set (settings, "gtk-enable-animations", FALSE, NULL);
+  g_assert_false (adw_get_enable_animations (widget));
+
+  g_object_set (settings, "gtk-enable-animations", TRUE, NULL);
+  g_assert_true (adw_get_enable_animations (widget));
+}
+
+static void
+test_adw_animation_frame_rate_limit (void)
+{
+  g_assert_cmpuint (adw_get_animation_frame_rate_limit (), ==, 0);
+
+  adw_set_animation_frame_rate_limit (30);
+  g_assert_cmpuint (adw_get_animation_frame_rate_limit (), ==, 30);
+
+  adw_set_animation_frame_rate_limit (0);
+  g_assert_cmpuint (adw_get_animation_frame_rate_limit (), ==, 0);
+}
+
+static void
+test_adw_animation_reduce_motion (void)
+{
+  g_assert_false (adw_get_reduce_motion ());
+
+  adw_set_reduce_motion (TRUE);
+  g_assert_true (adw_get_reduce_motion ());
+
+  adw_set_reduce_motion (FALSE);
+  g_assert_false (adw_get_reduce_motion ());
+}
+
+static void
+test_adw_animation_throttle_inactive_windows (void)
+{
+  g_assert_false (adw_get_throttle_inactive_windows ());
+
+  adw_set_throttle_inactive_windows (TRUE);
+  g_assert_true (adw_get_throttle_inactive_windows ());
+
+  adw_set_throttle_inactive_windows (FALSE);
+  g_assert_false (adw_get_throttle_inactive_windows ());
+}
+
+static void
+test_adw_animation_virtual_clock (void)
+{
+  g_autoptr (GtkWidget) widget = g_object_ref_sink (gtk_button_new ());
+  g_autoptr (AdwAnimation) animation = NULL;
+  AnimationData data = { 0, 0, 0 };
+
+  g_object_set (gtk_widget_get_settings (widget), "gtk-enable-animations", TRUE, NULL);
+
+  adw_frame_clock_set_virtual (TRUE);
+
+  /* The widget isn't mapped, that's fine with the virtual clock */
+  animation = adw_animation_new (widget, 0, 1, 100, adw_ease_out_cubic,
+                                 (AdwAnimationValueCallback) value_cb,
+                                 (AdwAnimationDoneCallback) done_cb,
+                                 &data);
+  adw_animation_start (animation);
+  g_assert_cmpuint (adw_frame_clock_get_n_tick_callbacks (), ==, 1);
+  g_assert_cmpint (data.n_done, ==, 0);
+
+  adw_frame_clock_advance (50000);
+  g_assert_cmpfloat_with_epsilon (data.value, adw_ease_out_cubic (0.5), 0.0001);
+  g_assert_cmpint (data.n_done, ==, 0);
+
+  adw_frame_clock_advance (50000);
+  g_assert_cmpfloat (data.value, ==, 1);
+  g_assert_cmpint (data.n_done, ==, 1);
+  g_assert_cmpuint (adw_frame_clock_get_n_tick_callbacks (), ==, 0);
+
+  adw_frame_clock_set_virtual (FALSE);
+}
+
+static void
+test_adw_animation_reduce_motion_skips (void)
+{
+  g_autoptr (GtkWidget) widget = g_object_ref_sink (gtk_button_new ());
+  g_autoptr (AdwAnimation) animation = NULL;
+  g_autoptr (AdwAnimation) essential_animation = NULL;
+  AnimationData data = { 0, 0, 0 };
+  AnimationData essential_data = { 0, 0, 0 };
+
+  g_object_set (gtk_widget_get_settings (widget), "gtk-enable-animations", TRUE, NULL);
+
+  adw_frame_clock_set_virtual (TRUE);
+  adw_set_reduce_motion (TRUE);
+
+  animation = adw_animation_new (widget, 0, 1, 100, adw_ease_out_cubic,
+                                 (AdwAnimationValueCallback) value_cb,
+                                 (AdwAnimationDoneCallback) done_cb,
+                                 &data);
+  adw_animation_set_essential (animation, FALSE);
+  adw_animation_start (animation);
+
+  /* Non-essential animations finish immediately */
+  g_assert_cmpfloat (data.value, ==, 1);
+  g_assert_cmpint (data.n_done, ==, 1);
+  g_assert_cmpuint (adw_frame_clock_get_n_tick_callbacks (), ==, 0);
+
+  essential_animation = adw_animation_new (widget, 0, 1, 100, adw_ease_out_cubic,
+                                           (AdwAnimationValueCallback) value_cb,
+                                           (AdwAnimationDoneCallback) done_cb,
+                                           &essential_data);
+  adw_animation_start (essential_animation);
+
+  /* Essential ones still run */
+  g_assert_cmpint (essential_data.n_done, ==, 0);
+  g_assert_cmpuint (adw_frame_clock_get_n_tick_callbacks (), ==, 1);
+
+  adw_frame_clock_advance (100000);
+  g_assert_cmpint (essential_data.n_done, ==, 1);
+
+  adw_set_reduce_motion (FALSE);
+  adw_frame_clock_set_virtual (FALSE);
+}
+
+static void
+test_adw_animation_frame_rate_limit_skips (void)
+{
+  g_autoptr (GtkWidget) widget = g_object_ref_sink (gtk_button_new ());
+  g_autoptr (AdwAnimation) animation = NULL;
+  AnimationData data = { 0, 0, 0 };
+
+  g_object_set (gtk_widget_get_settings (widget), "gtk-enable-animations", TRUE, NULL);
+
+  adw_frame_clock_set_virtual (TRUE);
+  adw_set_animation_frame_rate_limit (10);
+
+  animation = adw_animation_new (widget, 0, 1, 1000, adw_ease_out_cubic,
+                                 (AdwAnimationValueCallback) value_cb,
+                                 (AdwAnimationDoneCallback) done_cb,
+                                 &data);
+  adw_animation_start (animation);
+
+  adw_frame_clock_advance (16000);
+  g_assert_cmpint (data.n_values, ==, 1);
+
+  /* 10 frames per second, so the next update is 100 ms after the first one */
+  adw_frame_clock_advance (16000);
+  g_assert_cmpint (data.n_values, ==, 1);
+
+  adw_frame_clock_advance (84000);
+  g_assert_cmpint (data.n_values, ==, 2);
+
+  adw_animation_stop (animation);
+
+  adw_set_animation_frame_rate_limit (0);
+  adw_frame_clock_set_virtual (FALSE);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  gtk_test_init (&argc, &argv, NULL);
+  adw_init ();
+
+  g_test_add_func("/Adwaita/Animation/enable_animations", test_adw_animation_enable_animations);
+  g_test_add_func("/Adwaita/Animation/frame_rate_limit", test_adw_animation_frame_rate_limit);
+  g_test_add_func("/Adwaita/Animation/reduce_motion", test_adw_animation_reduce_motion);
+  g_test_add_func("/Adwaita/Animation/throttle_inactive_windows", test_adw_animation_throttle_inactive_windows);
+  g_test_add_func("/Adwaita/Animation/virtual_clock", test_adw_animation_virtual_clock);
+  g_test_add_func("/Adwaita/Animation/reduce_motion_skips", test_adw_animation_reduce_motion_skips);
+  g_test_add_func("/Adwaita/Animation/frame_rate_limit_skips", test_adw_animation_frame_rate_limit_skips);
+
+  return g_test_run();
+}
@@ -62,6 +62,80 @@ test_adw_carousel_add_remove (void)
   g_object_unref (carousel);
 }
 
+static void
+test_adw_carousel_add_remove_pages (void)
+{
+  AdwCarousel *carousel;
+  GtkWidget *children[5];
+  GtkWidget *removed[3];
+  guint i;
+
+  carousel = ADW_CAROUSEL (adw_carousel_new ());
+
+  for (i = 0; i < G_N_ELEMENTS (children); i++)
+    children[i] = gtk_label_new ("");
+
+  notified = 0;
+  g_signal_connect (carousel, "notify::n-pages", G_CALLBACK (notify_cb), NULL);
+
+  adw_carousel_insert_pages (carousel, children, 0, -1, TRUE);
+  g_assert_cmpuint (adw_carousel_get_n_pages (carousel), ==, 0);
+  g_assert_cmpint (notified, ==, 0);
+
+  adw_carousel_insert_pages (carousel, children + 2, 3, -1, TRUE);
+  g_assert_cmpuint (adw_carousel_get_n_pages (carousel), ==, 3);
+  g_assert_cmpint (notified, ==, 1);
+
+  adw_carousel_insert_pages (carousel, children, 2, 0, FALSE);
+  g_assert_cmpuint (adw_carousel_get_n_pages (carousel), ==, 5);
+  g_assert_cmpint (notified, ==, 2);
+
+  for (i = 0; i < G_N_ELEMENTS (children); i++)
+    g_assert_true (adw_carousel_get_nth_page (carousel, i) == children[i]);
+
+  removed[0] = children[4];
+  removed[1] = children[0];
+  removed[2] = children[2];
+
+  adw_carousel_remove_pages (carousel, removed, 3, FALSE);
+  g_assert_cmpuint (adw_carousel_get_n_pages (carousel), ==, 2);
+  g_assert_cmpint (notified, ==, 3);
+  g_assert_true (adw_carousel_get_nth_page (carousel, 0) == children[1]);
+  g_assert_true (adw_carousel_get_nth_page (carousel, 1) == children[3]);
+
+  adw_carousel_remove_pages (carousel, children + 1, 1, TRUE);
+  g_assert_cmpuint (adw_carousel_get_n_pages (carousel), ==, 1);
+  g_assert_cmpint (notified, ==, 4);
+
+  g_object_unref (carousel);
+}
+
+static void
+test_adw_carousel_insert_pages_position (void)
+{
+  AdwCarousel *carousel;
+  GtkWidget *children[5];
+  guint i;
+
+  carousel = g_object_ref_sink (ADW_CAROUSEL (adw_carousel_new ()));
+
+  for (i = 0; i < G_N_ELEMENTS (children); i++)
+    children[i] = gtk_label_new ("");
+
+  adw_carousel_insert_pages (carousel, children + 2, 3, -1, FALSE);
+  adw_carousel_scroll_to_full (carousel, children[3], 0);
+  g_assert_cmpfloat (adw_carousel_get_position (carousel), ==, 1);
+
+  /* Prepending pages keeps the same page visible */
+  adw_carousel_insert_pages (carousel, children, 2, 0, FALSE);
+  g_assert_cmpfloat (adw_carousel_get_position (carousel), ==, 3);
+
+  adw_carousel_scroll_to_full (carousel, children[4], 0);
+  g_assert_cmpfloat (adw_carousel_get_position (carousel), ==, 4);
+
+  g_object_unref (carousel);
+}
+
 static void
 test_adw_carousel_interactive (void)
 {
@@ -218,6 +292,78 @@ test_adw_carousel_reveal_duration (void)
   g_assert_cmpint (notified, ==, 2);
 }
 
+static void
+test_adw_carousel_uniform_pages (void)
+{
+  AdwCarousel *carousel = ADW_CAROUSEL (adw_carousel_new ());
+  gboolean uniform_pages;
+
+  notified = 0;
+  g_signal_connect (carousel, "notify::uniform-pages", G_CALLBACK (notify_cb), NULL);
+
+  /* Accessors */
+  g_assert_false (adw_carousel_get_uniform_pages (carousel));
+  adw_carousel_set_uniform_pages (carousel, TRUE);
+  g_assert_true (adw_carousel_get_uniform_pages (carousel));
+  g_assert_cmpint (notified, ==, 1);
+
+  /* Property */
+  g_object_set (carousel, "uniform-pages", FALSE, NULL);
+  g_object_get (carousel, "uniform-pages", &uniform_pages, NULL);
+  g_assert_false (uniform_pages);
+  g_assert_cmpint (notified, ==, 2);
+
+  /* Setting the same value should not notify */
+  adw_carousel_set_uniform_pages (carousel, FALSE);
+  g_assert_cmpint (notified, ==, 2);
+}
+
+static void
+test_adw_carousel_uniform_pages_sizes (void)
+{
+  GtkWidget *window = gtk_window_new ();
+  AdwCarousel *carousel = ADW_CAROUSEL (adw_carousel_new ());
+  const char *labels[] = { "Medium page", "A", "The longest page of them all" };
+  GtkWidget *pages[G_N_ELEMENTS (labels)];
+  int page_nat[G_N_ELEMENTS (labels)];
+  int nat;
+  guint i;
+
+  gtk_window_set_child (GTK_WINDOW (window), GTK_WIDGET (carousel));
+  adw_carousel_set_uniform_pages (carousel, TRUE);
+
+  /* Ellipsized, so that every page can be allocated the first page's size */
+  for (i = 0; i < G_N_ELEMENTS (labels); i++) {
+    pages[i] = gtk_label_new (labels[i]);
+    gtk_label_set_ellipsize (GTK_LABEL (pages[i]), PANGO_ELLIPSIZE_END);
+    adw_carousel_append (carousel, pages[i]);
+
+    gtk_widget_measure (pages[i], GTK_ORIENTATION_HORIZONTAL, -1,
+                        NULL, &page_nat[i], NULL, NULL);
+  }
+
+  g_assert_cmpint (page_nat[0], !=, page_nat[1]);
+  g_assert_cmpint (page_nat[0], <, page_nat[2]);
+
+  /* Only the first page is measured */
+  gtk_widget_measure (GTK_WIDGET (carousel), GTK_ORIENTATION_HORIZONTAL, -1,
+                      NULL, &nat, NULL, NULL);
+  g_assert_cmpint (nat, ==, page_nat[0]);
+
+  /* Every page gets its size */
+  gtk_widget_realize (GTK_WIDGET (carousel));
+  gtk_widget_measure (GTK_WIDGET (carousel), GTK_ORIENTATION_VERTICAL, nat,
+                      NULL, NULL, NULL, NULL);
+  gtk_widget_allocate (GTK_WIDGET (carousel), nat, 100, -1, NULL);
+
+  g_assert_cmpfloat (adw_swipeable_get_distance (ADW_SWIPEABLE (carousel)), ==, page_nat[0]);
+
+  for (i = 0; i < G_N_ELEMENTS (labels); i++)
+    g_assert_cmpint (gtk_widget_get_width (pages[i]), ==, page_nat[0]);
+
+  gtk_window_destroy (GTK_WINDOW (window));
+}
+
 int
 main (int   argc,
       char *argv[])
@@ -226,11 +372,15 @@ main (int   argc,
   adw_init ();
 
   g_test_add_func("/Adwaita/Carousel/add_remove", test_adw_carousel_add_remove);
+  g_test_add_func("/Adwaita/Carousel/add_remove_pages", test_adw_carousel_add_remove_pages);
+  g_test_add_func("/Adwaita/Carousel/insert_pages_position", test_adw_carousel_insert_pages_position);
   g_test_add_func("/Adwaita/Carousel/interactive", test_adw_carousel_interactive);
   g_test_add_func("/Adwaita/Carousel/spacing", test_adw_carousel_spacing);
   g_test_add_func("/Adwaita/Carousel/animation_duration", test_adw_carousel_animation_duration);
   g_test_add_func("/Adwaita/Carousel/allow_mouse_drag", test_adw_carousel_allow_mouse_drag);
   g_test_add_func("/Adwaita/Carousel/allow_long_swipes", test_adw_carousel_allow_long_swipes);
   g_test_add_func("/Adwaita/Carousel/reveal_duration", test_adw_carousel_reveal_duration);
+  g_test_add_func("/Adwaita/Carousel/uniform_pages", test_adw_carousel_uniform_pages);
+  g_test_add_func("/Adwaita/Carousel/uniform_pages_sizes", test_adw_carousel_uniform_pages_sizes);
   return g_test_run();
 }
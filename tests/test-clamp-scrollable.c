@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include <adwaita.h>
+
+static void
+allocate (GtkWidget *widget,
+          int        width,
+          int        height)
+{
+  gtk_widget_measure (widget, GTK_ORIENTATION_HORIZONTAL, -1,
+                      NULL, NULL, NULL, NULL);
+  gtk_widget_measure (widget, GTK_ORIENTATION_VERTICAL, width,
+                      NULL, NULL, NULL, NULL);
+  gtk_widget_allocate (widget, width, height, -1, NULL);
+}
+
+static double
+get_scroll_fraction (GtkAdjustment *adjustment)
+{
+  double lower = gtk_adjustment_get_lower (adjustment);
+  double range = gtk_adjustment_get_upper (adjustment) - lower -
+                 gtk_adjustment_get_page_size (adjustment);
+
+  return (gtk_adjustment_get_value (adjustment) - lower) / range;
+}
+
+static void
+test_adw_clamp_scrollable_quantization_step (void)
+{
+  g_autoptr (AdwClampScrollable) clamp = NULL;
+  GtkWidget *viewport;
+  int width;
+
+  clamp = g_object_ref_sink (ADW_CLAMP_SCROLLABLE (adw_clamp_scrollable_new ()));
+  g_assert_nonnull (clamp);
+
+  g_assert_cmpint (adw_clamp_scrollable_get_quantization_step (clamp), ==, 0);
+
+  viewport = gtk_viewport_new (NULL, NULL);
+  gtk_viewport_set_child (GTK_VIEWPORT (viewport), gtk_box_new (GTK_ORIENTATION_VERTICAL, 0));
+  adw_clamp_scrollable_set_child (clamp, viewport);
+
+  /* Between 400 and 1000 pixels, the child is between 400 and 600 */
+  adw_clamp_scrollable_set_maximum_size (clamp, 600);
+  adw_clamp_scrollable_set_tightening_threshold (clamp, 400);
+
+  allocate (GTK_WIDGET (clamp), 500, 100);
+  width = gtk_widget_get_width (viewport);
+
+  allocate (GTK_WIDGET (clamp), 510, 100);
+  g_assert_cmpint (gtk_widget_get_width (viewport), !=, width);
+
+  adw_clamp_scrollable_set_quantization_step (clamp, 100);
+  g_assert_cmpint (adw_clamp_scrollable_get_quantization_step (clamp), ==, 100);
+
+  /* The same step */
+  allocate (GTK_WIDGET (clamp), 500, 100);
+  width = gtk_widget_get_width (viewport);
+  g_assert_cmpint (width, ==, 400);
+
+  allocate (GTK_WIDGET (clamp), 510, 100);
+  g_assert_cmpint (gtk_widget_get_width (viewport), ==, width);
+
+  /* The next step */
+  allocate (GTK_WIDGET (clamp), 700, 100);
+  g_assert_cmpint (gtk_widget_get_width (viewport), ==, 500);
+
+  /* Not quantized beyond the clamping range */
+  allocate (GTK_WIDGET (clamp), 350, 100);
+  g_assert_cmpint (gtk_widget_get_width (viewport), ==, 350);
+
+  allocate (GTK_WIDGET (clamp), 1200, 100);
+  g_assert_cmpint (gtk_widget_get_width (viewport), ==, 600);
+}
+
+static void
+test_adw_clamp_scrollable_scroll_anchor (void)
+{
+  g_autoptr (AdwClampScrollable) clamp = NULL;
+  g_autoptr (GString) text = g_string_new (NULL);
+  GtkAdjustment *adjustment;
+  GtkWidget *viewport, *label;
+  double upper;
+  int i;
+
+  clamp = g_object_ref_sink (ADW_CLAMP_SCROLLABLE (adw_clamp_scrollable_new ()));
+
+  for (i = 0; i < 200; i++)
+    g_string_append (text, "Lorem ipsum dolor sit amet ");
+
+  label = gtk_label_new (text->str);
+  gtk_label_set_wrap (GTK_LABEL (label), TRUE);
+
+  viewport = gtk_viewport_new (NULL, NULL);
+  gtk_viewport_set_child (GTK_VIEWPORT (viewport), label);
+  adw_clamp_scrollable_set_child (clamp, viewport);
+
+  adjustment = gtk_adjustment_new (0, 0, 0, 0, 0, 0);
+  gtk_scrollable_set_vadjustment (GTK_SCROLLABLE (clamp), adjustment);
+
+  allocate (GTK_WIDGET (clamp), 1000, 100);
+  upper = gtk_adjustment_get_upper (adjustment);
+  g_assert_cmpfloat (upper, >, 100);
+
+  gtk_adjustment_set_value (adjustment, (upper - 100) / 2);
+  g_assert_cmpfloat_with_epsilon (get_scroll_fraction (adjustment), 0.5, 0.001);
+
+  /* The text reflows, but stays at the same place */
+  allocate (GTK_WIDGET (clamp), 500, 100);
+  g_assert_cmpfloat (gtk_adjustment_get_upper (adjustment), >, upper);
+  g_assert_cmpfloat_with_epsilon (get_scroll_fraction (adjustment), 0.5, 0.001);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  gtk_test_init (&argc, &argv, NULL);
+  adw_init ();
+
+  g_test_add_func("/Adwaita/ClampScrollable/quantization_step", test_adw_clamp_scrollable_quantization_step);
+  g_test_add_func("/Adwaita/ClampScrollable/scroll_anchor", test_adw_clamp_scrollable_scroll_anchor);
+
+  return g_test_run();
+}
@@ -8,6 +8,8 @@
 
 #include <adwaita.h>
 
+#include "adw-frame-clock-private.h"
+
 int notified;
 
 static void
@@ -399,6 +401,102 @@ test_adw_flap_swipe_to_close (void)
   g_assert_cmpint (notified, ==, 2);
 }
 
+static void
+test_adw_flap_stable_allocation (void)
+{
+  g_autoptr (AdwFlap) flap = NULL;
+  gboolean stable_allocation;
+
+  flap = g_object_ref_sink (ADW_FLAP (adw_flap_new ()));
+  g_assert_nonnull (flap);
+
+  notified = 0;
+  g_signal_connect (flap, "notify::stable-allocation", G_CALLBACK (notify_cb), NULL);
+
+  g_object_get (flap, "stable-allocation", &stable_allocation, NULL);
+  g_assert_false (stable_allocation);
+
+  adw_flap_set_stable_allocation (flap, FALSE);
+  g_assert_cmpint (notified, ==, 0);
+
+  adw_flap_set_stable_allocation (flap, TRUE);
+  g_assert_true (adw_flap_get_stable_allocation (flap));
+  g_assert_cmpint (notified, ==, 1);
+
+  g_object_set (flap, "stable-allocation", FALSE, NULL);
+  g_assert_false (adw_flap_get_stable_allocation (flap));
+  g_assert_cmpint (notified, ==, 2);
+}
+
+static void
+allocate (GtkWidget *widget,
+          int        width,
+          int        height)
+{
+  gtk_widget_measure (widget, GTK_ORIENTATION_HORIZONTAL, -1,
+                      NULL, NULL, NULL, NULL);
+  gtk_widget_measure (widget, GTK_ORIENTATION_VERTICAL, width,
+                      NULL, NULL, NULL, NULL);
+  gtk_widget_allocate (widget, width, height, -1, NULL);
+}
+
+static void
+test_adw_flap_stable_allocation_sizes (void)
+{
+  g_autoptr (AdwFlap) flap = NULL;
+  GtkWidget *content, *flap_child;
+  int i;
+
+  adw_frame_clock_set_virtual (TRUE);
+
+  flap = g_object_ref_sink (ADW_FLAP (adw_flap_new ()));
+  adw_flap_set_fold_policy (flap, ADW_FLAP_FOLD_POLICY_NEVER);
+  adw_flap_set_stable_allocation (flap, TRUE);
+
+  content = gtk_label_new ("");
+  gtk_widget_set_size_request (content, 100, 100);
+  adw_flap_set_content (flap, content);
+
+  flap_child = gtk_label_new ("");
+  gtk_widget_set_size_request (flap_child, 50, 100);
+  adw_flap_set_flap (flap, flap_child);
+
+  allocate (GTK_WIDGET (flap), 300, 100);
+  g_assert_cmpint (gtk_widget_get_width (content), ==, 250);
+  g_assert_cmpint (gtk_widget_get_width (flap_child), ==, 50);
+
+  /* While the flap is being hidden, the content keeps its largest width */
+  adw_flap_set_reveal_flap (flap, FALSE);
+
+  for (i = 0; i < 3; i++) {
+    adw_frame_clock_advance (16667);
+    g_assert_cmpfloat (adw_flap_get_reveal_progress (flap), >, 0);
+    g_assert_cmpfloat (adw_flap_get_reveal_progress (flap), <, 1);
+
+    allocate (GTK_WIDGET (flap), 300, 100);
+    g_assert_cmpint (gtk_widget_get_width (content), ==, 300);
+    g_assert_cmpint (gtk_widget_get_width (flap_child), ==, 50);
+  }
+
+  /* A child changing its size during the transition is picked up */
+  gtk_widget_set_size_request (flap_child, 80, 100);
+
+  for (i = 0; i < 3; i++) {
+    adw_frame_clock_advance (16667);
+    g_assert_cmpfloat (adw_flap_get_reveal_progress (flap), >, 0);
+
+    allocate (GTK_WIDGET (flap), 300, 100);
+    g_assert_cmpint (gtk_widget_get_width (content), ==, 300);
+    g_assert_cmpint (gtk_widget_get_width (flap_child), ==, 80);
+  }
+
+  adw_frame_clock_advance (1000000);
+  g_assert_cmpfloat (adw_flap_get_reveal_progress (flap), ==, 0);
+  g_assert_cmpuint (adw_frame_clock_get_n_tick_callbacks (), ==, 0);
+
+  adw_frame_clock_set_virtual (FALSE);
+}
+
 int
 main (int   argc,
       char *argv[])
@@ -420,6 +518,8 @@ main (int   argc,
   g_test_add_func ("/Adwaita/Flap/modal", test_adw_flap_modal);
   g_test_add_func ("/Adwaita/Flap/swipe_to_open", test_adw_flap_swipe_to_open);
   g_test_add_func ("/Adwaita/Flap/swipe_to_close", test_adw_flap_swipe_to_close);
+  g_test_add_func ("/Adwaita/Flap/stable_allocation", test_adw_flap_stable_allocation);
+  g_test_add_func ("/Adwaita/Flap/stable_allocation_sizes", test_adw_flap_stable_allocation_sizes);
 
   return g_test_run ();
 }
@@ -121,6 +121,64 @@ test_adw_header_bar_centering_policy (void)
 }
 
 
+static int
+count_window_controls (GtkWidget *widget)
+{
+  GtkWidget *child;
+  int n = GTK_IS_WINDOW_CONTROLS (widget) ? 1 : 0;
+
+  for (child = gtk_widget_get_first_child (widget);
+       child;
+       child = gtk_widget_get_next_sibling (child))
+    n += count_window_controls (child);
+
+  return n;
+}
+
+
+static void
+test_adw_header_bar_window_controls (void)
+{
+  GtkSettings *settings = gtk_settings_get_default ();
+  g_autofree char *old_layout = NULL;
+  GtkWidget *window;
+  AdwHeaderBar *bar;
+
+  g_object_get (settings, "gtk-decoration-layout", &old_layout, NULL);
+  g_object_set (settings, "gtk-decoration-layout", "icon:close", NULL);
+
+  window = gtk_window_new ();
+  bar = ADW_HEADER_BAR (adw_header_bar_new ());
+  gtk_window_set_child (GTK_WINDOW (window), GTK_WIDGET (bar));
+
+  g_assert_cmpint (count_window_controls (GTK_WIDGET (bar)), ==, 2);
+
+  /* No controls for a side without buttons */
+  g_object_set (settings, "gtk-decoration-layout", "menu:close", NULL);
+  g_assert_cmpint (count_window_controls (GTK_WIDGET (bar)), ==, 1);
+
+  g_object_set (settings, "gtk-decoration-layout", "menu:", NULL);
+  g_assert_cmpint (count_window_controls (GTK_WIDGET (bar)), ==, 0);
+
+  adw_header_bar_set_decoration_layout (bar, "close:");
+  g_assert_cmpint (count_window_controls (GTK_WIDGET (bar)), ==, 1);
+
+  /* Nor for a header bar that isn't at the edge of the window */
+  adw_header_bar_set_decoration_layout (bar, NULL);
+  g_object_set (settings, "gtk-decoration-layout", "icon:close", NULL);
+  adw_header_bar_set_show_start_title_buttons (bar, FALSE);
+  adw_header_bar_set_show_end_title_buttons (bar, FALSE);
+  g_assert_cmpint (count_window_controls (GTK_WIDGET (bar)), ==, 0);
+
+  adw_header_bar_set_show_end_title_buttons (bar, TRUE);
+  g_assert_cmpint (count_window_controls (GTK_WIDGET (bar)), ==, 1);
+
+  gtk_window_destroy (GTK_WINDOW (window));
+
+  g_object_set (settings, "gtk-decoration-layout", old_layout, NULL);
+}
+
+
 int
 main (int   argc,
       char *argv[])
@@ -134,6 +192,7 @@ main (int   argc,
   g_test_add_func("/Adwaita/HeaderBar/show_end_title_buttons", test_adw_header_bar_show_end_title_buttons);
   g_test_add_func("/Adwaita/HeaderBar/decoration_layout", test_adw_header_bar_decoration_layout);
   g_test_add_func("/Adwaita/HeaderBar/centering_policy", test_adw_header_bar_centering_policy);
+  g_test_add_func("/Adwaita/HeaderBar/window_controls", test_adw_header_bar_window_controls);
 
   return g_test_run();
 }
@@ -208,6 +208,170 @@ test_adw_leaflet_reorder_child_after (void)
 }
 
 
+static void
+test_adw_leaflet_navigatable_neighbours (void)
+{
+  g_autoptr (AdwLeaflet) leaflet = NULL;
+  GtkWidget *children[4];
+  GtkWidget *extra;
+  AdwLeafletPage *page;
+  int i;
+
+  leaflet = ADW_LEAFLET (adw_leaflet_new ());
+  g_assert_nonnull (leaflet);
+
+  for (i = 0; i < 4; i++) {
+    children[i] = gtk_label_new ("");
+    g_assert_nonnull (children[i]);
+
+    adw_leaflet_append (leaflet, children[i]);
+  }
+
+  adw_leaflet_set_visible_child (leaflet, children[1]);
+  g_assert_true (adw_leaflet_get_adjacent_child (leaflet, ADW_NAVIGATION_DIRECTION_BACK) == children[0]);
+  g_assert_true (adw_leaflet_get_adjacent_child (leaflet, ADW_NAVIGATION_DIRECTION_FORWARD) == children[2]);
+
+  page = adw_leaflet_get_page (leaflet, children[2]);
+  adw_leaflet_page_set_navigatable (page, FALSE);
+  g_assert_true (adw_leaflet_get_adjacent_child (leaflet, ADW_NAVIGATION_DIRECTION_FORWARD) == children[3]);
+
+  extra = gtk_label_new ("");
+  adw_leaflet_insert_child_after (leaflet, extra, children[1]);
+  g_assert_true (adw_leaflet_get_adjacent_child (leaflet, ADW_NAVIGATION_DIRECTION_FORWARD) == extra);
+
+  adw_leaflet_remove (leaflet, extra);
+  g_assert_true (adw_leaflet_get_adjacent_child (leaflet, ADW_NAVIGATION_DIRECTION_FORWARD) == children[3]);
+
+  adw_leaflet_page_set_navigatable (page, TRUE);
+  g_assert_true (adw_leaflet_get_adjacent_child (leaflet, ADW_NAVIGATION_DIRECTION_FORWARD) == children[2]);
+
+  adw_leaflet_reorder_child_after (leaflet, children[0], children[3]);
+  g_assert_null (adw_leaflet_get_adjacent_child (leaflet, ADW_NAVIGATION_DIRECTION_BACK));
+  g_assert_true (adw_leaflet_get_adjacent_child (leaflet, ADW_NAVIGATION_DIRECTION_FORWARD) == children[2]);
+
+  adw_leaflet_remove (leaflet, children[2]);
+  g_assert_true (adw_leaflet_get_adjacent_child (leaflet, ADW_NAVIGATION_DIRECTION_FORWARD) == children[3]);
+
+  adw_leaflet_set_visible_child (leaflet, children[0]);
+  g_assert_true (adw_leaflet_get_adjacent_child (leaflet, ADW_NAVIGATION_DIRECTION_BACK) == children[3]);
+  g_assert_null (adw_leaflet_get_adjacent_child (leaflet, ADW_NAVIGATION_DIRECTION_FORWARD));
+}
+
+
+static void
+test_adw_leaflet_child_by_name (void)
+{
+  g_autoptr (AdwLeaflet) leaflet = NULL;
+  GtkWidget *children[3];
+  AdwLeafletPage *pages[3];
+  int i;
+
+  leaflet = ADW_LEAFLET (adw_leaflet_new ());
+  g_assert_nonnull (leaflet);
+
+  for (i = 0; i < 3; i++) {
+    g_autofree char *name = g_strdup_printf ("%d", i);
+
+    children[i] = gtk_label_new ("");
+    pages[i] = adw_leaflet_append (leaflet, children[i]);
+    adw_leaflet_page_set_name (pages[i], name);
+  }
+
+  g_assert_true (adw_leaflet_get_child_by_name (leaflet, "0") == children[0]);
+  g_assert_true (adw_leaflet_get_child_by_name (leaflet, "2") == children[2]);
+
+  adw_leaflet_page_set_name (pages[0], "first");
+  g_assert_null (adw_leaflet_get_child_by_name (leaflet, "0"));
+  g_assert_true (adw_leaflet_get_child_by_name (leaflet, "first") == children[0]);
+
+  adw_leaflet_page_set_name (pages[2], "0");
+  g_assert_true (adw_leaflet_get_child_by_name (leaflet, "0") == children[2]);
+  g_assert_null (adw_leaflet_get_child_by_name (leaflet, "2"));
+
+  adw_leaflet_reorder_child_after (leaflet, children[2], NULL);
+  g_assert_true (adw_leaflet_get_child_by_name (leaflet, "0") == children[2]);
+
+  adw_leaflet_set_visible_child_name (leaflet, "1");
+  g_assert_true (adw_leaflet_get_visible_child (leaflet) == children[1]);
+
+  adw_leaflet_remove (leaflet, children[0]);
+  g_assert_null (adw_leaflet_get_child_by_name (leaflet, "first"));
+  g_assert_true (adw_leaflet_get_child_by_name (leaflet, "1") == children[1]);
+}
+
+
+static GtkWidget *
+restore_page_cb (AdwLeaflet     *leaflet,
+                 AdwLeafletPage *page,
+                 int            *n_restored)
+{
+  (*n_restored)++;
+
+  return gtk_label_new (adw_leaflet_page_get_name (page));
+}
+
+
+static void
+test_adw_leaflet_unload_pages (void)
+{
+  g_autoptr (AdwLeaflet) leaflet = NULL;
+  g_autoptr (GtkSelectionModel) pages = NULL;
+  AdwLeafletPage *page;
+  int n_restored = 0;
+  int i;
+
+  leaflet = ADW_LEAFLET (adw_leaflet_new ());
+  g_assert_nonnull (leaflet);
+
+  adw_leaflet_set_can_unfold (leaflet, FALSE);
+  adw_leaflet_set_unload_pages (leaflet, TRUE);
+  g_assert_true (adw_leaflet_get_unload_pages (leaflet));
+
+  g_signal_connect (leaflet, "restore-page", G_CALLBACK (restore_page_cb), &n_restored);
+
+  for (i = 0; i < 5; i++) {
+    g_autofree char *name = g_strdup_printf ("%d", i);
+
+    page = adw_leaflet_append (leaflet, gtk_label_new (name));
+    adw_leaflet_page_set_name (page, name);
+  }
+
+  adw_leaflet_set_visible_child_name (leaflet, "4");
+  g_assert_cmpint (n_restored, ==, 0);
+
+  g_assert_true (adw_leaflet_navigate (leaflet, ADW_NAVIGATION_DIRECTION_BACK));
+  g_assert_cmpstr (adw_leaflet_get_visible_child_name (leaflet), ==, "3");
+  g_assert_cmpint (n_restored, ==, 1);
+  g_assert_nonnull (adw_leaflet_get_adjacent_child (leaflet, ADW_NAVIGATION_DIRECTION_BACK));
+  g_assert_nonnull (adw_leaflet_get_adjacent_child (leaflet, ADW_NAVIGATION_DIRECTION_FORWARD));
+
+  adw_leaflet_set_visible_child_name (leaflet, "0");
+  g_assert_cmpint (n_restored, ==, 3);
+
+  /* Looking at the pages doesn't restore them */
+  pages = adw_leaflet_get_pages (leaflet);
+  for (i = 0; i < 5; i++) {
+    g_autoptr (AdwLeafletPage) item = g_list_model_get_item (G_LIST_MODEL (pages), i);
+
+    if (i < 2)
+      g_assert_nonnull (adw_leaflet_page_get_child (item));
+    else
+      g_assert_null (adw_leaflet_page_get_child (item));
+  }
+  g_assert_null (adw_leaflet_get_child_by_name (leaflet, "4"));
+  g_assert_cmpint (n_restored, ==, 3);
+
+  page = g_list_model_get_item (G_LIST_MODEL (pages), 4);
+  adw_leaflet_remove_page (leaflet, page);
+  g_object_unref (page);
+  g_assert_cmpuint (g_list_model_get_n_items (G_LIST_MODEL (pages)), ==, 4);
+  g_assert_cmpint (n_restored, ==, 3);
+
+  adw_leaflet_set_unload_pages (leaflet, FALSE);
+  g_assert_cmpint (n_restored, ==, 5);
+}
+
+
 int
 main (int   argc,
       char *argv[])
@@ -220,6 +384,9 @@ main (int   argc,
   g_test_add_func ("/Adwaita/Leaflet/prepend", test_adw_leaflet_prepend);
   g_test_add_func ("/Adwaita/Leaflet/insert_child_after", test_adw_leaflet_insert_child_after);
   g_test_add_func ("/Adwaita/Leaflet/reorder_child_after", test_adw_leaflet_reorder_child_after);
+  g_test_add_func ("/Adwaita/Leaflet/navigatable_neighbours", test_adw_leaflet_navigatable_neighbours);
+  g_test_add_func ("/Adwaita/Leaflet/child_by_name", test_adw_leaflet_child_by_name);
+  g_test_add_func ("/Adwaita/Leaflet/unload_pages", test_adw_leaflet_unload_pages);
 
   return g_test_run ();
 }
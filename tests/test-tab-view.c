@@ -226,6 +226,35 @@ test_adw_tab_view_shortcut_widget (void)
   g_assert_cmpint (notified, ==, 2);
 }
 
+static void
+test_adw_tab_view_throttle_background_updates (void)
+{
+  g_autoptr (AdwTabView) view = NULL;
+  gboolean throttle;
+
+  view = g_object_ref_sink (ADW_TAB_VIEW (adw_tab_view_new ()));
+  g_assert_nonnull (view);
+
+  notified = 0;
+  g_signal_connect (view, "notify::throttle-background-updates", G_CALLBACK (notify_cb), NULL);
+
+  g_object_get (view, "throttle-background-updates", &throttle, NULL);
+  g_assert_false (throttle);
+  g_assert_cmpint (notified, ==, 0);
+
+  adw_tab_view_set_throttle_background_updates (view, FALSE);
+  g_assert_cmpint (notified, ==, 0);
+
+  adw_tab_view_set_throttle_background_updates (view, TRUE);
+  g_object_get (view, "throttle-background-updates", &throttle, NULL);
+  g_assert_true (throttle);
+  g_assert_cmpint (notified, ==, 1);
+
+  g_object_set (view, "throttle-background-updates", FALSE, NULL);
+  g_assert_false (adw_tab_view_get_throttle_background_updates (view));
+  g_assert_cmpint (notified, ==, 2);
+}
+
 static void
 test_adw_tab_view_pages (void)
 {
@@ -261,6 +290,56 @@ test_adw_tab_view_pages (void)
   g_assert_true (adw_tab_page_get_child (page3) == child3);
 }
 
+static void
+test_adw_tab_view_search_pages (void)
+{
+  g_autoptr (AdwTabView) view = NULL;
+  g_autofree guint *results = NULL;
+  AdwTabPage *page;
+  guint n_results;
+
+  view = g_object_ref_sink (ADW_TAB_VIEW (adw_tab_view_new ()));
+  g_assert_nonnull (view);
+
+  page = adw_tab_view_append (view, gtk_button_new ());
+  adw_tab_page_set_title (page, "Daily Notes");
+  page = adw_tab_view_append (view, gtk_button_new ());
+  adw_tab_page_set_title (page, "Notes");
+  page = adw_tab_view_append (view, gtk_button_new ());
+  adw_tab_page_set_title (page, "Keynotes");
+  page = adw_tab_view_append (view, gtk_button_new ());
+  adw_tab_page_set_title (page, "Nothing Else");
+  page = adw_tab_view_append (view, gtk_button_new ());
+  adw_tab_page_set_title (page, "Untitled");
+  adw_tab_page_set_tooltip (page, "<b>NOTES</b> backup");
+
+  results = adw_tab_view_search_pages (view, "notes", 0, &n_results);
+  g_assert_cmpuint (n_results, ==, 5);
+  g_assert_cmpuint (results[0], ==, 1);
+  g_assert_cmpuint (results[1], ==, 0);
+  g_assert_cmpuint (results[2], ==, 2);
+  /* Title matches always come before tooltip matches */
+  g_assert_cmpuint (results[3], ==, 3);
+  g_assert_cmpuint (results[4], ==, 4);
+  g_clear_pointer (&results, g_free);
+
+  results = adw_tab_view_search_pages (view, "notes", 2, &n_results);
+  g_assert_cmpuint (n_results, ==, 2);
+  g_clear_pointer (&results, g_free);
+
+  adw_tab_page_set_title (page, "Scratch");
+  adw_tab_page_set_tooltip (page, NULL);
+
+  results = adw_tab_view_search_pages (view, "scr", 0, &n_results);
+  g_assert_cmpuint (n_results, ==, 1);
+  g_assert_cmpuint (results[0], ==, 4);
+  g_clear_pointer (&results, g_free);
+
+  results = adw_tab_view_search_pages (view, "xyz", 0, &n_results);
+  g_assert_null (results);
+  g_assert_cmpuint (n_results, ==, 0);
+}
+
 static void
 test_adw_tab_view_select (void)
 {
@@ -863,6 +942,117 @@ test_adw_tab_view_close_select (void)
   g_assert_true (adw_tab_view_get_selected_page (view) == pages[1]);
 }
 
+static void
+test_adw_tab_view_close_selection (void)
+{
+  g_autoptr (AdwTabView) view = NULL;
+  AdwTabViewCloseSelection close_selection;
+  AdwTabPage *pages[5];
+
+  view = g_object_ref_sink (ADW_TAB_VIEW (adw_tab_view_new ()));
+  g_assert_nonnull (view);
+
+  notified = 0;
+  g_signal_connect (view, "notify::close-selection", G_CALLBACK (notify_cb), NULL);
+
+  g_object_get (view, "close-selection", &close_selection, NULL);
+  g_assert_cmpint (close_selection, ==, ADW_TAB_VIEW_CLOSE_SELECTION_POSITION);
+
+  adw_tab_view_set_close_selection (view, ADW_TAB_VIEW_CLOSE_SELECTION_POSITION);
+  g_assert_cmpint (notified, ==, 0);
+
+  adw_tab_view_set_close_selection (view, ADW_TAB_VIEW_CLOSE_SELECTION_RECENT);
+  g_assert_cmpint (adw_tab_view_get_close_selection (view), ==, ADW_TAB_VIEW_CLOSE_SELECTION_RECENT);
+  g_assert_cmpint (notified, ==, 1);
+
+  g_object_set (view, "close-selection", ADW_TAB_VIEW_CLOSE_SELECTION_POSITION, NULL);
+  g_assert_cmpint (adw_tab_view_get_close_selection (view), ==, ADW_TAB_VIEW_CLOSE_SELECTION_POSITION);
+  g_assert_cmpint (notified, ==, 2);
+
+  g_assert_null (adw_tab_view_get_next_recent_page (view, NULL));
+  g_assert_null (adw_tab_view_get_previous_recent_page (view, NULL));
+
+  add_pages (view, pages, 5, 0);
+
+  adw_tab_view_set_selected_page (view, pages[3]);
+  adw_tab_view_set_selected_page (view, pages[1]);
+
+  g_assert_true (adw_tab_view_get_next_recent_page (view, NULL) == pages[1]);
+  g_assert_true (adw_tab_view_get_next_recent_page (view, pages[1]) == pages[3]);
+  g_assert_true (adw_tab_view_get_next_recent_page (view, pages[3]) == pages[0]);
+  g_assert_true (adw_tab_view_get_previous_recent_page (view, NULL) == pages[4]);
+  g_assert_true (adw_tab_view_get_previous_recent_page (view, pages[3]) == pages[1]);
+  g_assert_null (adw_tab_view_get_previous_recent_page (view, pages[1]));
+
+  adw_tab_view_set_close_selection (view, ADW_TAB_VIEW_CLOSE_SELECTION_RECENT);
+
+  adw_tab_view_close_page (view, pages[1]);
+  g_assert_true (adw_tab_view_get_selected_page (view) == pages[3]);
+
+  adw_tab_view_close_page (view, pages[3]);
+  g_assert_true (adw_tab_view_get_selected_page (view) == pages[0]);
+
+  g_assert_true (adw_tab_view_get_next_recent_page (view, pages[0]) == pages[2]);
+  g_assert_true (adw_tab_view_get_next_recent_page (view, pages[2]) == pages[4]);
+  g_assert_null (adw_tab_view_get_next_recent_page (view, pages[4]));
+}
+
+static void
+test_adw_tab_view_detach_hidden_pages (void)
+{
+  g_autoptr (AdwTabView) view = NULL;
+  gboolean detach_hidden_pages;
+  AdwTabPage *pages[6];
+  int i;
+
+  view = g_object_ref_sink (ADW_TAB_VIEW (adw_tab_view_new ()));
+  g_assert_nonnull (view);
+
+  notified = 0;
+  g_signal_connect (view, "notify::detach-hidden-pages", G_CALLBACK (notify_cb), NULL);
+
+  g_object_get (view, "detach-hidden-pages", &detach_hidden_pages, NULL);
+  g_assert_false (detach_hidden_pages);
+
+  adw_tab_view_set_detach_hidden_pages (view, FALSE);
+  g_assert_cmpint (notified, ==, 0);
+
+  add_pages (view, pages, 6, 0);
+
+  for (i = 0; i < 6; i++)
+    g_assert_nonnull (gtk_widget_get_parent (adw_tab_page_get_child (pages[i])));
+
+  /* The selected page and 3 most recent ones stay attached */
+  adw_tab_view_set_detach_hidden_pages (view, TRUE);
+  g_assert_true (adw_tab_view_get_detach_hidden_pages (view));
+  g_assert_cmpint (notified, ==, 1);
+
+  for (i = 0; i < 4; i++)
+    g_assert_nonnull (gtk_widget_get_parent (adw_tab_page_get_child (pages[i])));
+  g_assert_null (gtk_widget_get_parent (adw_tab_page_get_child (pages[4])));
+  g_assert_null (gtk_widget_get_parent (adw_tab_page_get_child (pages[5])));
+
+  g_assert_true (adw_tab_view_get_page (view, adw_tab_page_get_child (pages[5])) == pages[5]);
+
+  adw_tab_view_set_selected_page (view, pages[5]);
+  g_assert_nonnull (gtk_widget_get_parent (adw_tab_page_get_child (pages[5])));
+  g_assert_null (gtk_widget_get_parent (adw_tab_page_get_child (pages[3])));
+
+  /* Selects pages[4], and pages[2] moves back into the recent set */
+  adw_tab_view_close_page (view, pages[5]);
+  g_assert_true (adw_tab_view_get_selected_page (view) == pages[4]);
+  g_assert_nonnull (gtk_widget_get_parent (adw_tab_page_get_child (pages[4])));
+  g_assert_nonnull (gtk_widget_get_parent (adw_tab_page_get_child (pages[2])));
+  g_assert_null (gtk_widget_get_parent (adw_tab_page_get_child (pages[3])));
+
+  g_object_set (view, "detach-hidden-pages", FALSE, NULL);
+  g_assert_false (adw_tab_view_get_detach_hidden_pages (view));
+  g_assert_cmpint (notified, ==, 2);
+
+  for (i = 0; i < 5; i++)
+    g_assert_nonnull (gtk_widget_get_parent (adw_tab_page_get_child (pages[i])));
+}
+
 static void
 test_adw_tab_view_transfer (void)
 {
@@ -1113,6 +1303,84 @@ test_adw_tab_page_needs_attention (void)
   g_assert_cmpint (notified, ==, 2);
 }
 
+static void
+test_adw_tab_page_thumbnail (void)
+{
+  g_autoptr (AdwTabView) view = NULL;
+  GdkPaintable *thumbnail;
+  AdwTabPage *page;
+
+  view = g_object_ref_sink (ADW_TAB_VIEW (adw_tab_view_new ()));
+  g_assert_nonnull (view);
+
+  page = adw_tab_view_append (view, gtk_button_new ());
+  g_assert_nonnull (page);
+
+  notified = 0;
+  g_signal_connect (page, "notify::thumbnail", G_CALLBACK (notify_cb), NULL);
+
+  g_object_get (page, "thumbnail", &thumbnail, NULL);
+  g_assert_null (thumbnail);
+
+  /* The page has never been on screen, there's nothing to capture */
+  adw_tab_page_invalidate_thumbnail (page);
+  adw_tab_view_append (view, gtk_button_new ());
+  adw_tab_view_set_selected_page (view, adw_tab_view_get_nth_page (view, 1));
+
+  g_assert_null (adw_tab_page_get_thumbnail (page));
+  g_assert_cmpint (notified, ==, 0);
+}
+
+static void
+test_adw_tab_page_thumbnail_capture (void)
+{
+  GtkWidget *window;
+  AdwTabView *view;
+  AdwTabPage *page;
+  GtkWidget *child;
+  GdkPaintable *thumbnail;
+  gint64 end_time;
+
+  window = gtk_window_new ();
+  gtk_window_set_default_size (GTK_WINDOW (window), 400, 300);
+
+  view = ADW_TAB_VIEW (adw_tab_view_new ());
+  gtk_window_set_child (GTK_WINDOW (window), GTK_WIDGET (view));
+
+  child = gtk_label_new ("Page");
+  page = adw_tab_view_append (view, child);
+  adw_tab_view_append (view, gtk_label_new ("Other page"));
+
+  notified = 0;
+  g_signal_connect (page, "notify::thumbnail", G_CALLBACK (notify_cb), NULL);
+
+  gtk_window_present (GTK_WINDOW (window));
+
+  end_time = g_get_monotonic_time () + 5 * G_USEC_PER_SEC;
+  while ((!gtk_widget_get_mapped (child) || gtk_widget_get_width (child) <= 0) &&
+         g_get_monotonic_time () < end_time)
+    g_main_context_iteration (NULL, FALSE);
+
+  g_assert_true (gtk_widget_get_mapped (child));
+
+  /* Deselecting the page captures it, the thumbnail is rendered afterwards */
+  adw_tab_view_set_selected_page (view, adw_tab_view_get_nth_page (view, 1));
+  g_assert_null (adw_tab_page_get_thumbnail (page));
+
+  end_time = g_get_monotonic_time () + 5 * G_USEC_PER_SEC;
+  while (notified == 0 && g_get_monotonic_time () < end_time)
+    g_main_context_iteration (NULL, FALSE);
+
+  g_assert_cmpint (notified, ==, 1);
+
+  thumbnail = adw_tab_page_get_thumbnail (page);
+  g_assert_nonnull (thumbnail);
+  g_assert_cmpint (gdk_paintable_get_intrinsic_width (thumbnail), <=, 256);
+  g_assert_cmpint (gdk_paintable_get_intrinsic_height (thumbnail), <=, 256);
+
+  gtk_window_destroy (GTK_WINDOW (window));
+}
+
 int
 main (int   argc,
       char *argv[])
@@ -1125,7 +1393,9 @@ main (int   argc,
   g_test_add_func ("/Adwaita/TabView/default_icon", test_adw_tab_view_default_icon);
   g_test_add_func ("/Adwaita/TabView/menu_model", test_adw_tab_view_menu_model);
   g_test_add_func ("/Adwaita/TabView/shortcut_widget", test_adw_tab_view_shortcut_widget);
+  g_test_add_func ("/Adwaita/TabView/throttle_background_updates", test_adw_tab_view_throttle_background_updates);
   g_test_add_func ("/Adwaita/TabView/pages", test_adw_tab_view_pages);
+  g_test_add_func ("/Adwaita/TabView/search_pages", test_adw_tab_view_search_pages);
   g_test_add_func ("/Adwaita/TabView/select", test_adw_tab_view_select);
   g_test_add_func ("/Adwaita/TabView/add_basic", test_adw_tab_view_add_basic);
   g_test_add_func ("/Adwaita/TabView/add_auto", test_adw_tab_view_add_auto);
@@ -1138,6 +1408,8 @@ main (int   argc,
   g_test_add_func ("/Adwaita/TabView/close_before_after", test_adw_tab_view_close_before_after);
   g_test_add_func ("/Adwaita/TabView/close_signal", test_adw_tab_view_close_signal);
   g_test_add_func ("/Adwaita/TabView/close_select", test_adw_tab_view_close_select);
+  g_test_add_func ("/Adwaita/TabView/close_selection", test_adw_tab_view_close_selection);
+  g_test_add_func ("/Adwaita/TabView/detach_hidden_pages", test_adw_tab_view_detach_hidden_pages);
   g_test_add_func ("/Adwaita/TabView/transfer", test_adw_tab_view_transfer);
   g_test_add_func ("/Adwaita/TabPage/title", test_adw_tab_page_title);
   g_test_add_func ("/Adwaita/TabPage/tooltip", test_adw_tab_page_tooltip);
@@ -1146,6 +1418,8 @@ main (int   argc,
   g_test_add_func ("/Adwaita/TabPage/indicator_icon", test_adw_tab_page_indicator_icon);
   g_test_add_func ("/Adwaita/TabPage/indicator_activatable", test_adw_tab_page_indicator_activatable);
   g_test_add_func ("/Adwaita/TabPage/needs_attention", test_adw_tab_page_needs_attention);
+  g_test_add_func ("/Adwaita/TabPage/thumbnail", test_adw_tab_page_thumbnail);
+  g_test_add_func ("/Adwaita/TabPage/thumbnail_capture", test_adw_tab_page_thumbnail_capture);
 
   return g_test_run ();
 }
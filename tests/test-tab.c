@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2021 Purism SPC
+ *
+ * SPDX-License-Identifier: LGPL-2.1+
+ */
+
+#include <adwaita.h>
+
+#include "adw-frame-clock-private.h"
+#include "adw-tab-private.h"
+
+int notified;
+
+static void
+notify_cb (GtkWidget *widget, gpointer data)
+{
+  notified++;
+}
+
+static void
+test_adw_tab_freeze_updates (void)
+{
+  g_autoptr (AdwTabView) view = g_object_ref_sink (ADW_TAB_VIEW (adw_tab_view_new ()));
+  g_autoptr (AdwTab) tab = NULL;
+  g_autoptr (GIcon) icon = g_themed_icon_new ("go-home-symbolic");
+  AdwTabPage *page;
+
+  adw_frame_clock_set_virtual (TRUE);
+
+  page = adw_tab_view_append (view, gtk_button_new ());
+  g_assert_true (adw_tab_page_get_selected (page));
+
+  tab = g_object_ref_sink (adw_tab_new (view, FALSE));
+  adw_tab_set_page (tab, page);
+
+  /* Every update is applied to the selected tab right away */
+  notified = 0;
+  g_signal_connect (tab, "notify::tooltip-text", G_CALLBACK (notify_cb), NULL);
+
+  adw_tab_page_set_title (page, "Title 1");
+  adw_tab_page_set_title (page, "Title 2");
+  g_assert_cmpint (notified, ==, 2);
+
+  /* While frozen, they are applied once with the next frame */
+  adw_tab_page_freeze_updates (page);
+  adw_tab_page_set_title (page, "Title 3");
+  adw_tab_page_set_icon (page, icon);
+  adw_tab_page_set_loading (page, TRUE);
+  adw_tab_page_set_needs_attention (page, TRUE);
+  adw_tab_page_set_title (page, "Title 4");
+  adw_tab_page_thaw_updates (page);
+  g_assert_cmpint (notified, ==, 2);
+  g_assert_cmpuint (adw_frame_clock_get_n_tick_callbacks (), ==, 1);
+
+  adw_frame_clock_advance (16667);
+  g_assert_cmpint (notified, ==, 3);
+  g_assert_cmpstr (gtk_widget_get_tooltip_text (GTK_WIDGET (tab)), ==, "Title 4");
+  g_assert_cmpuint (adw_frame_clock_get_n_tick_callbacks (), ==, 0);
+
+  adw_frame_clock_advance (16667);
+  g_assert_cmpint (notified, ==, 3);
+
+  /* Thawed again */
+  adw_tab_page_set_title (page, "Title 5");
+  g_assert_cmpint (notified, ==, 4);
+
+  g_clear_object (&tab);
+
+  adw_frame_clock_set_virtual (FALSE);
+}
+
+int
+main (int   argc,
+      char *argv[])
+{
+  gtk_test_init (&argc, &argv, NULL);
+  adw_init ();
+
+  g_test_add_func("/Adwaita/Tab/freeze_updates", test_adw_tab_freeze_updates);
+
+  return g_test_run();
+}
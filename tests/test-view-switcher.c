@@ -68,6 +68,46 @@ test_adw_view_switcher_stack (void)
 }
 
 
+static void
+test_adw_view_switcher_policy_sizes (void)
+{
+  g_autoptr (GtkStack) stack = g_object_ref_sink (GTK_STACK (gtk_stack_new ()));
+  AdwViewSwitcherPolicy policies[] = {
+    ADW_VIEW_SWITCHER_POLICY_AUTO,
+    ADW_VIEW_SWITCHER_POLICY_NARROW,
+    ADW_VIEW_SWITCHER_POLICY_WIDE,
+  };
+  int heights[G_N_ELEMENTS (policies)];
+  guint i;
+
+  for (i = 0; i < 3; i++) {
+    g_autofree char *name = g_strdup_printf ("page%u", i);
+    GtkStackPage *page = gtk_stack_add_titled (stack, gtk_label_new (name), name, name);
+
+    gtk_stack_page_set_icon_name (page, "go-home-symbolic");
+  }
+
+  /* Buttons are as tall as their tallest layout whatever the policy */
+  for (i = 0; i < G_N_ELEMENTS (policies); i++) {
+    GtkWidget *window = gtk_window_new ();
+    GtkWidget *view_switcher = adw_view_switcher_new ();
+
+    adw_view_switcher_set_policy (ADW_VIEW_SWITCHER (view_switcher), policies[i]);
+    adw_view_switcher_set_stack (ADW_VIEW_SWITCHER (view_switcher), stack);
+    gtk_window_set_child (GTK_WINDOW (window), view_switcher);
+
+    gtk_widget_measure (view_switcher, GTK_ORIENTATION_VERTICAL, -1,
+                        &heights[i], NULL, NULL, NULL);
+    g_assert_cmpint (heights[i], >, 0);
+
+    gtk_window_destroy (GTK_WINDOW (window));
+  }
+
+  g_assert_cmpint (heights[0], ==, heights[1]);
+  g_assert_cmpint (heights[0], ==, heights[2]);
+}
+
+
 int
 main (int   argc,
       char *argv[])
@@ -78,6 +118,7 @@ main (int   argc,
   g_test_add_func("/Adwaita/ViewSwitcher/policy", test_adw_view_switcher_policy);
   g_test_add_func("/Adwaita/ViewSwitcher/narrow_ellipsize", test_adw_view_switcher_narrow_ellipsize);
   g_test_add_func("/Adwaita/ViewSwitcher/stack", test_adw_view_switcher_stack);
+  g_test_add_func("/Adwaita/ViewSwitcher/policy_sizes", test_adw_view_switcher_policy_sizes);
 
   return g_test_run();
 }